@@ -0,0 +1,95 @@
+/**
+ * @file ALTITUDE.h
+ * @author Ing. Lucas Kirschner
+ * @date 15 Oct 2026
+ * @brief Altitud barométrica y presión reducida a nivel del mar (QNH) sin `powf` por muestra.
+ *
+ * Usa la fórmula de la atmósfera estándar internacional (troposfera, hasta 11 km):
+ *
+ *     h = 44330,77 * (1 - (p / p0)^0,190263)        QNH = p / (1 - h_est / 44330,77)^5,255876
+ *
+ * La potencia de la altitud se evalúa separando p / p0 = m * 2^e (m en [1, 2)): 2^(0,190263 e)
+ * sale de una tabla y m^0,190263 de un polinomio de grado 5 ajustado en los nodos de Chebyshev
+ * (casi minimax), con un error relativo máximo de 1,5e-6. Sumado al redondeo en simple precisión,
+ * el error de la altitud frente a la fórmula exacta en doble precisión queda por debajo de
+ * ALTITUDE_ERROR_BOUND_M en todo el rango de 300 a 1100 hPa del BMP280. El factor del QNH sólo
+ * depende de la altitud de la estación, por lo que se calcula una vez en ::ALTITUDE_Init.
+ */
+
+#ifndef ALTITUDE_INC_ALTITUDE_H_
+#define ALTITUDE_INC_ALTITUDE_H_
+
+#include <stdint.h>
+
+#define ALTITUDE_SEA_LEVEL_HPA		1013.25f	/**< Presión de referencia de la atmósfera estándar */
+#define ALTITUDE_ERROR_BOUND_M		0.1f		/**< Error máximo garantizado frente a la fórmula exacta */
+
+/**
+ * @brief Códigos de estado del módulo ALTITUDE.
+ */
+typedef enum
+{
+	ALTITUDE_OK = 0,               /**< Operación exitosa */
+	ALTITUDE_ERROR_PARAM,          /**< Presión o referencia fuera de rango */
+	ALTITUDE_ERROR_SELF_TEST       /**< La aproximación excede ALTITUDE_ERROR_BOUND_M */
+} altitude_status_t;
+
+/**
+ * @brief Referencias para el cálculo. Se completa con ::ALTITUDE_Init.
+ */
+typedef struct
+{
+	float seaLevel;                /**< Presión a nivel del mar para la altitud (hPa) */
+	float invSeaLevel;             /**< 1 / seaLevel, evita la división por muestra */
+	float stationAltitude;         /**< Altitud conocida del sensor para el QNH (m) */
+	float qnhFactor;               /**< (1 - stationAltitude / 44330,77)^-5,255876 */
+} altitude_ref_t;
+
+/**
+ * @brief Fija la presión de referencia y la altitud de la estación.
+ *
+ * Es el único lugar del módulo que usa `powf`.
+ *
+ * @param ref             Referencias a inicializar.
+ * @param seaLevel        Presión a nivel del mar en hPa (ALTITUDE_SEA_LEVEL_HPA o el QNH local).
+ * @param stationAltitude Altitud del sensor en metros, para ::ALTITUDE_Get_QNH.
+ * @return ALTITUDE_OK o ALTITUDE_ERROR_PARAM.
+ */
+altitude_status_t ALTITUDE_Init(altitude_ref_t *ref, float seaLevel, float stationAltitude);
+
+/**
+ * @brief Calcula la altitud a partir de la presión compensada.
+ *
+ * @param ref      Referencias.
+ * @param pressure Presión en hPa (por ejemplo `bmp.pressure`).
+ * @param altitude Destino de la altitud en metros.
+ * @return ALTITUDE_OK, o ALTITUDE_ERROR_PARAM si p / p0 está fuera de [1/256, 16).
+ */
+altitude_status_t ALTITUDE_Get(const altitude_ref_t *ref, float pressure, float *altitude);
+
+/**
+ * @brief Reduce la presión medida en la estación a nivel del mar (QNH).
+ *
+ * @param ref      Referencias.
+ * @param pressure Presión en hPa.
+ * @return QNH en hPa.
+ */
+float ALTITUDE_Get_QNH(const altitude_ref_t *ref, float pressure);
+
+#ifdef BMP280_BENCHMARK
+/**
+ * @brief Verifica la aproximación y mide su costo frente a `powf`.
+ *
+ * Recorre de 300 a 1100 hPa en pasos de 0,01 hPa con varias presiones de referencia,
+ * compara contra la fórmula exacta en doble precisión y, si el error máximo no supera
+ * ALTITUDE_ERROR_BOUND_M, imprime por SWO el error y los ticks por muestra de la
+ * aproximación y de `powf` (ciclos DWT en el target, ns con `BENCH_HOST`). Se compila con
+ * el mismo flag que el benchmark de compensación.
+ *
+ * @param iterations Cantidad de cálculos a medir por método.
+ * @return ALTITUDE_OK, ALTITUDE_ERROR_PARAM o ALTITUDE_ERROR_SELF_TEST.
+ */
+altitude_status_t ALTITUDE_Benchmark(uint32_t iterations);
+#endif
+
+#endif /* ALTITUDE_INC_ALTITUDE_H_ */
@@ -0,0 +1,167 @@
+/**
+ * @file ALTITUDE.c
+ * @author Ing. Lucas Kirschner
+ * @date 15 Oct 2026
+ * @brief Implementación de la altitud barométrica con potencia por tabla y polinomio.
+ */
+
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "ALTITUDE.h"
+
+#define ALT_SCALE_M			44330.77f	/* T0 / L = 288,15 K / 0,0065 K/m */
+#define ALT_EXPONENT		0.190263f	/* R L / (g M) */
+#define ALT_QNH_EXPONENT	5.255876f	/* g M / (R L) */
+
+#define ALT_EXP_MIN			(-8)		/* Rango de exponentes binarios de p / p0 en la tabla */
+#define ALT_EXP_MAX			3
+
+/* 2^(ALT_EXPONENT * e) para e = ALT_EXP_MIN ... ALT_EXP_MAX */
+static const float expTable[ALT_EXP_MAX - ALT_EXP_MIN + 1] = {
+	3.481777701e-01f, 3.972609799e-01f, 4.532635330e-01f, 5.171608608e-01f,
+	5.900659032e-01f, 6.732484928e-01f, 7.681574729e-01f, 8.764459327e-01f,
+	1.000000000e+00f, 1.140971693e+00f, 1.301816405e+00f, 1.485335668e+00f
+};
+
+/* m^ALT_EXPONENT en m = [1, 2), en potencias de t = 2m - 3 (interpolación en nodos de Chebyshev) */
+#define ALT_C0		1.080197659e+00f
+#define ALT_C1		6.850757215e-02f
+#define ALT_C2		(-9.226783236e-03f)
+#define ALT_C3		1.853898169e-03f
+#define ALT_C4		(-4.838952640e-04f)
+#define ALT_C5		1.240598147e-04f
+
+/**
+ * @brief Calcula ratio^ALT_EXPONENT sin `powf`.
+ *
+ * @param ratio Cociente p / p0, positivo.
+ * @param out   Destino del resultado.
+ * @return ALTITUDE_OK, o ALTITUDE_ERROR_PARAM si el exponente binario queda fuera de la tabla.
+ */
+static altitude_status_t ALTITUDE_Pow_Ratio(float ratio, float *out)
+{
+	uint32_t bits;
+	int32_t exponent;
+	float mantissa, t;
+
+	/* ratio = mantissa * 2^exponent, con mantissa en [1, 2) (formato IEEE 754) */
+	memcpy(&bits, &ratio, sizeof(bits));
+	exponent = (int32_t)((bits >> 23) & 0xFFu) - 127;
+	if(exponent < ALT_EXP_MIN || exponent > ALT_EXP_MAX)
+		return ALTITUDE_ERROR_PARAM;
+	bits = (bits & 0x007FFFFFu) | 0x3F800000u;
+	memcpy(&mantissa, &bits, sizeof(mantissa));
+
+	t = 2.0f * mantissa - 3.0f;
+	*out = expTable[exponent - ALT_EXP_MIN] *
+	       (ALT_C0 + t * (ALT_C1 + t * (ALT_C2 + t * (ALT_C3 + t * (ALT_C4 + t * ALT_C5)))));
+
+	return ALTITUDE_OK;
+}
+
+altitude_status_t ALTITUDE_Init(altitude_ref_t *ref, float seaLevel, float stationAltitude)
+{
+	if(ref == NULL || !(seaLevel > 0.0f) || !(stationAltitude < ALT_SCALE_M))
+		return ALTITUDE_ERROR_PARAM;
+
+	ref->seaLevel = seaLevel;
+	ref->invSeaLevel = 1.0f / seaLevel;
+	ref->stationAltitude = stationAltitude;
+	ref->qnhFactor = powf(1.0f - stationAltitude / ALT_SCALE_M, -ALT_QNH_EXPONENT);
+
+	return ALTITUDE_OK;
+}
+
+altitude_status_t ALTITUDE_Get(const altitude_ref_t *ref, float pressure, float *altitude)
+{
+	float power;
+
+	if(ref == NULL || altitude == NULL || !(pressure > 0.0f))
+		return ALTITUDE_ERROR_PARAM;
+
+	if(ALTITUDE_Pow_Ratio(pressure * ref->invSeaLevel, &power) != ALTITUDE_OK)
+		return ALTITUDE_ERROR_PARAM;
+
+	*altitude = ALT_SCALE_M * (1.0f - power);
+
+	return ALTITUDE_OK;
+}
+
+float ALTITUDE_Get_QNH(const altitude_ref_t *ref, float pressure)
+{
+	return pressure * ref->qnhFactor;
+}
+
+#ifdef BMP280_BENCHMARK
+
+#include "API_swo.h"
+#include "BENCH.h"
+
+#define BENCH_PRESS_MIN		300.0		/* Rango de medición del BMP280 (hPa) */
+#define BENCH_PRESS_MAX		1100.0
+#define BENCH_PRESS_STEP	0.01
+
+/* Presiones de referencia: QNH bajos y altos, además del estándar */
+static const float benchSeaLevel[] = { 950.0f, ALTITUDE_SEA_LEVEL_HPA, 1050.0f };
+
+altitude_status_t ALTITUDE_Benchmark(uint32_t iterations)
+{
+	altitude_ref_t ref;
+	float altitude, maxError = 0.0f;
+	volatile float sink;
+	uint32_t start, fastTicks, powTicks;
+
+	if(iterations == 0)
+		return ALTITUDE_ERROR_PARAM;
+
+	/* Exactitud: todo el rango del sensor contra la fórmula en doble precisión */
+	for(uint32_t r = 0; r < sizeof(benchSeaLevel) / sizeof(benchSeaLevel[0]); r++)
+	{
+		if(ALTITUDE_Init(&ref, benchSeaLevel[r], 0.0f) != ALTITUDE_OK)
+			return ALTITUDE_ERROR_SELF_TEST;
+
+		for(uint32_t i = 0; i <= (uint32_t)((BENCH_PRESS_MAX - BENCH_PRESS_MIN) / BENCH_PRESS_STEP + 0.5); i++)
+		{
+			float pressure = (float)(BENCH_PRESS_MIN + i * BENCH_PRESS_STEP);
+			double exact = 44330.77 * (1.0 - pow((double)pressure / benchSeaLevel[r], 0.190263));
+			float error;
+
+			if(ALTITUDE_Get(&ref, pressure, &altitude) != ALTITUDE_OK)
+				return ALTITUDE_ERROR_SELF_TEST;
+			error = (float)fabs((double)altitude - exact);
+			if(error > maxError)
+				maxError = error;
+		}
+	}
+
+	if(maxError > ALTITUDE_ERROR_BOUND_M)
+		return ALTITUDE_ERROR_SELF_TEST;
+
+	/* Costo: la presión varía en cada iteración para que no se reutilicen resultados */
+	ALTITUDE_Init(&ref, ALTITUDE_SEA_LEVEL_HPA, 0.0f);
+	BENCH_Init();
+
+	start = BENCH_Now();
+	for(uint32_t i = 0; i < iterations; i++)
+	{
+		ALTITUDE_Get(&ref, 300.0f + (float)(i & 0x3FF), &altitude);
+		sink = altitude;
+	}
+	fastTicks = BENCH_Elapsed(start) / iterations;
+
+	start = BENCH_Now();
+	for(uint32_t i = 0; i < iterations; i++)
+		sink = ALT_SCALE_M * (1.0f - powf((300.0f + (float)(i & 0x3FF)) * ref.invSeaLevel, ALT_EXPONENT));
+	powTicks = BENCH_Elapsed(start) / iterations;
+	(void)sink;
+
+	printf("Altitude max error: %lu mm\r\n", (unsigned long)(maxError * 1000.0f));
+	printf("Altitude FAST: %lu ticks (%lu ns)\r\n", (unsigned long)fastTicks, (unsigned long)BENCH_Ticks_To_Ns(fastTicks));
+	printf("Altitude POWF: %lu ticks (%lu ns)\r\n", (unsigned long)powTicks, (unsigned long)BENCH_Ticks_To_Ns(powTicks));
+
+	return ALTITUDE_OK;
+}
+
+#endif /* BMP280_BENCHMARK */
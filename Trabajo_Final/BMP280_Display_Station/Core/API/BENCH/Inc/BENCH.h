@@ -0,0 +1,51 @@
+/**
+ * @file BENCH.h
+ * @author Ing. Lucas Kirschner
+ * @date 15 Oct 2026
+ * @brief Módulo de medición de tiempos de ejecución basado en el contador de ciclos DWT.
+ *
+ * Permite medir la cantidad de ciclos de CPU que consume un fragmento de código
+ * utilizando el contador CYCCNT de la unidad DWT del Cortex-M4. Al compilar con
+ * `BENCH_HOST` definido, se utiliza el reloj monotónico del sistema operativo y
+ * los valores devueltos se expresan directamente en nanosegundos.
+ */
+
+#ifndef BENCH_INC_BENCH_H_
+#define BENCH_INC_BENCH_H_
+
+#include <stdint.h>
+
+/**
+ * @brief Inicializa el contador de ciclos.
+ *
+ * Habilita la unidad de traza (TRCENA) y el contador CYCCNT del DWT.
+ * Debe llamarse una vez antes de utilizar ::BENCH_Now.
+ */
+void BENCH_Init(void);
+
+/**
+ * @brief Devuelve el valor actual del contador.
+ *
+ * @return Ciclos de CPU en el target, nanosegundos en una compilación de host.
+ */
+uint32_t BENCH_Now(void);
+
+/**
+ * @brief Calcula el tiempo transcurrido desde una marca tomada con ::BENCH_Now.
+ *
+ * La resta en aritmética sin signo contempla el desborde del contador.
+ *
+ * @param start Marca de inicio.
+ * @return Ciclos (o nanosegundos en host) transcurridos.
+ */
+uint32_t BENCH_Elapsed(uint32_t start);
+
+/**
+ * @brief Convierte una cantidad de ticks del contador a nanosegundos.
+ *
+ * @param ticks Ticks medidos con ::BENCH_Elapsed.
+ * @return Tiempo equivalente en nanosegundos.
+ */
+uint32_t BENCH_Ticks_To_Ns(uint32_t ticks);
+
+#endif /* BENCH_INC_BENCH_H_ */
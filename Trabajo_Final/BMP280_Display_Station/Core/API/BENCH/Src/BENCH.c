@@ -0,0 +1,60 @@
+/**
+ * @file BENCH.c
+ * @author Ing. Lucas Kirschner
+ * @date 15 Oct 2026
+ * @brief Implementación del módulo de medición de tiempos mediante DWT->CYCCNT.
+ *
+ * En el target se lee el contador de ciclos del núcleo, que avanza a la frecuencia
+ * de HCLK. En host (`BENCH_HOST`) se usa `clock_gettime(CLOCK_MONOTONIC)`.
+ */
+
+#include "BENCH.h"
+
+#ifdef BENCH_HOST
+
+#include <time.h>
+
+void BENCH_Init(void)
+{
+}
+
+uint32_t BENCH_Now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)((uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec);
+}
+
+uint32_t BENCH_Ticks_To_Ns(uint32_t ticks)
+{
+	return ticks;								/* En host los ticks ya son nanosegundos */
+}
+
+#else
+
+#include "stm32f4xx_hal.h"
+
+void BENCH_Init(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;	/* Habilita DWT/ITM */
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;			/* Arranca el contador de ciclos */
+}
+
+uint32_t BENCH_Now(void)
+{
+	return DWT->CYCCNT;
+}
+
+uint32_t BENCH_Ticks_To_Ns(uint32_t ticks)
+{
+	return (uint32_t)(((uint64_t)ticks * 1000000000u) / SystemCoreClock);
+}
+
+#endif /* BENCH_HOST */
+
+uint32_t BENCH_Elapsed(uint32_t start)
+{
+	return BENCH_Now() - start;
+}
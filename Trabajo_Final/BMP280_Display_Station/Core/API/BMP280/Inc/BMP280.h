@@ -16,6 +16,8 @@
 #include <stdbool.h>
 
 #include "BMP280_port.h"
+#include "BMP280_bus.h"
+#include "BMP280_ring.h"
 
 /* BM280 Memory map --------------------------------------------*/
 #define REG_TEMP_XLSB			((uint8_t) 0xFC)
@@ -68,7 +70,7 @@
 #define TEMP_OVER_x2			((uint8_t) 0x40)
 #define TEMP_OVER_x4			((uint8_t) 0x60)
 #define TEMP_OVER_x8			((uint8_t) 0x80)
-#define TEMP_OVER_x16			((uint8_t) 0xF0)
+#define TEMP_OVER_x16			((uint8_t) 0xA0)
 
 /* BM280 Pressure oversampling settings ------------------------*/
 #define PRESS_OVER_SKIP			((uint8_t) 0x00)
@@ -92,6 +94,30 @@
 #define CHIP_RESET				((uint8_t) 0xB6)
 #define DUMMY_PKG				((uint8_t) 0x00)
 
+/* Impresión de cada muestra por SWO (0 para deshabilitarla, p. ej. al reproducir capturas) */
+#ifndef BMP280_PRINT_SAMPLES
+#define BMP280_PRINT_SAMPLES	1
+#endif
+
+/* BM280 burst sizes -------------------------------------------*/
+#define BMP280_CALIB_SIZE		((uint8_t) 24)	/* 0x88 ... 0x9F */
+#define BMP280_DATA_SIZE		((uint8_t) 6)	/* press_msb ... temp_xlsb */
+#define BMP280_STATUS_BURST_SIZE	((uint8_t) 10)	/* status ... temp_xlsb (0xF3 ... 0xFC) */
+#define BMP280_BURST_MAX		BMP280_CALIB_SIZE
+#define BMP280_ASYNC_SIZE		(BMP280_DATA_SIZE + 1)	/* Dirección + datos */
+
+/* Negociación de la velocidad de SCK (::BMP280_Negotiate_Clock) ---------*/
+#define BMP280_CLOCK_VALIDATE_READS		4	/* Lecturas de ID + calibración por velocidad probada */
+#define BMP280_CLOCK_FALLBACK_ERRORS	3	/* Errores seguidos que bajan una velocidad */
+
+/* Recuperación ante errores (::BMP280_Recover) ------------------------*/
+#define BMP280_RETRY_COUNT				2	/* Reintentos inmediatos de una transacción fallida */
+#define BMP280_STARTUP_MS				2	/* Arranque tras CHIP_RESET (hoja de datos, tabla 2: t_startup) */
+#define BMP280_RESET_POLLS				3	/* Consultas de ID y STATUS tras el arranque, separadas 1 ms */
+
+/* Copia de los registros escribibles (::BMP280_Verify_Registers) -------*/
+#define BMP280_VERIFY_PERIOD_MS			10000	/* Relectura periódica de ctrl_meas y config */
+
 /**
  * @brief Estados posibles que pueden devolver las funciones del driver.
  */
@@ -104,39 +130,204 @@ typedef enum
 	BMP280_ERROR_COMM,             /**< Error de comunicación con el sensor */
 	BMP280_ERROR_INVALID_ID,       /**< ID del sensor no coincide con BMP280 */
 	BMP280_ERROR_INVALID_MODE,     /**< Modo no válido */
-	BMP280_ERROR_NAN               /**< Resultado no numérico */
+	BMP280_ERROR_NAN,              /**< Resultado no numérico */
+	BMP280_ERROR_SELF_TEST,        /**< La compensación no coincide con el vector de referencia */
+	BMP280_ERROR_CONFIG,           /**< El sensor perdió ctrl_meas/config (reinicio o brownout): ::BMP280_Recover */
+	BMP280_BUSY                    /**< El bus lo tiene otro dispositivo (p. ej. el volcado del display); reintentar */
 } bmp280_status_t;
 
 /**
- * @brief Estructura de configuración y datos del sensor BMP280.
+ * @brief Algoritmo utilizado para compensar las lecturas crudas.
+ */
+typedef enum
+{
+	BMP280_COMP_FLOAT = 0,         /**< Fórmula en punto flotante de la hoja de datos (sección 8.1) */
+	BMP280_COMP_INT,               /**< Fórmula entera de referencia de Bosch: 32 bits (T) y 64 bits (P) */
+	BMP280_COMP_FLOAT_SP           /**< Fórmula flotante en simple precisión, sin divisiones por muestra */
+} bmp280_comp_t;
+
+/**
+ * @brief Configuración de medición del BMP280.
+ *
+ * Cada campo toma las constantes ya desplazadas a su posición en el registro
+ * (por ejemplo `TEMP_OVER_x2`, `FILTER_COEFF_X4`, `STANDBY_125`).
+ */
+typedef struct
+{
+	uint8_t osrsT;                 /**< Sobremuestreo de temperatura (TEMP_OVER_*) */
+	uint8_t osrsP;                 /**< Sobremuestreo de presión (PRESS_OVER_*) */
+	uint8_t filter;                /**< Coeficiente del filtro IIR (FILTER_COEFF_*) */
+	uint8_t standby;               /**< Reposo entre mediciones en NORMAL_MODE (STANDBY_*) */
+	uint8_t mode;                  /**< SLEEP_MODE, FORCED_MODE o NORMAL_MODE */
+} bmp280_config_t;
+
+/**
+ * @brief Perfiles de uso recomendados por la hoja de datos (sección 3.8.2).
+ */
+typedef enum
+{
+	BMP280_PROFILE_HANDHELD_LOW_POWER = 0, /**< Dispositivo portátil de bajo consumo: x2/x16, IIR 4, 62,5 ms */
+	BMP280_PROFILE_HANDHELD_DYNAMIC,       /**< Dispositivo portátil dinámico: x1/x4, IIR 16, 0,5 ms */
+	BMP280_PROFILE_WEATHER_MONITORING,     /**< Monitoreo del clima (mínimo consumo): x1/x1, sin IIR, forced */
+	BMP280_PROFILE_ELEVATOR,               /**< Detección de cambio de piso: x1/x4, IIR 4, 125 ms */
+	BMP280_PROFILE_DROP_DETECTION,         /**< Detección de caídas: x1/x2, sin IIR, 0,5 ms */
+	BMP280_PROFILE_INDOOR_NAVIGATION,      /**< Navegación en interiores: x2/x16, IIR 16, 0,5 ms */
+	BMP280_PROFILE_COUNT                   /**< Cantidad de perfiles */
+} bmp280_profile_t;
+
+/**
+ * @brief Contadores de instrumentación del driver.
+ */
+typedef struct
+{
+	uint32_t samples;              /**< Muestras leídas y compensadas con éxito */
+	uint32_t statusReads;          /**< Lecturas del registro STATUS (::BMP280_Is_Measuring, ::BMP280_Read_If_Ready) */
+	uint32_t transactions;         /**< Transacciones SPI (ventanas de CS) emitidas por el driver */
+	uint32_t clockFallbacks;       /**< Bajadas de velocidad de SCK por errores repetidos */
+	uint32_t retries;              /**< Transacciones o ráfagas repetidas tras un error (nivel 1) */
+	uint32_t softResets;           /**< Reinicios por software de ::BMP280_Recover (nivel 2) */
+	uint32_t busReinits;           /**< Reinicios del periférico de ::BMP280_Recover (nivel 3) */
+	uint32_t registerWrites;       /**< Registros escritos (cada par registro/valor de una transacción) */
+	uint32_t verifies;             /**< Relecturas de ctrl_meas y config (::BMP280_Verify_Registers) */
+} bmp280_stats_t;
+
+/* Constantes de calibración internas del BMP280 (registros 0x88 ... 0x9F) */
+typedef struct {
+    uint16_t dig_T1;
+    int16_t  dig_T2;
+    int16_t  dig_T3;
+    uint16_t dig_P1;
+    int16_t  dig_P2;
+    int16_t  dig_P3;
+    int16_t  dig_P4;
+    int16_t  dig_P5;
+    int16_t  dig_P6;
+    int16_t  dig_P7;
+    int16_t  dig_P8;
+    int16_t  dig_P9;
+} bmp280_calib_data_t;
+
+/* Coeficientes de calibración escalados para la compensación en simple precisión.
+ * Cada constante agrupa los cocientes por potencias de dos de la fórmula flotante,
+ * de modo que el cálculo por muestra se reduce a sumas y productos. */
+typedef struct {
+	float t1;         /* dig_T1 / 8192            */
+	float t2;         /* dig_T2 / 16384           */
+	float t12;        /* dig_T1 * dig_T2 / 1024   */
+	float t3;         /* dig_T3                   */
+	float p1;         /* dig_P1                   */
+	float invP1x6250; /* 6250 / dig_P1            */
+	float p2;         /* dig_P2 / 2^19            */
+	float p3;         /* dig_P3 / 2^38            */
+	float p4;         /* dig_P4 * 65536           */
+	float p5;         /* dig_P5 * 2               */
+	float p6;         /* dig_P6 / 32768           */
+	float p7;         /* dig_P7 / 16              */
+	float p8;         /* dig_P8 / 32768           */
+	float p9;         /* dig_P9 / 2^31            */
+} bmp280_calib_float_t;
+
+/**
+ * @brief Función que recibe cada ráfaga cruda leída, antes de compensarla (ver BMP280_capture.h).
+ *
+ * @param cs   Chip select del sensor.
+ * @param tick Marca de tiempo de la lectura (::BMP280_Port_Get_Tick).
+ * @param raw  Los BMP280_DATA_SIZE bytes leídos desde REG_PRESS_MSB.
+ */
+typedef void (*bmp280_capture_hook_t)(uint8_t cs, uint32_t tick, const uint8_t *raw);
+
+/**
+ * @brief Descriptor de una instancia del sensor BMP280.
+ *
+ * Contiene todo el estado del driver para un sensor: chip select, configuración,
+ * calibración, copia de los registros escritos, contadores y buffers de la ráfaga por DMA.
+ * Puede haber tantas instancias como chip selects tenga la tabla del puerto
+ * (BMP280_DEVICE_COUNT); cada una se inicializa con ::BMP280_Init.
  */
 typedef struct
 {
 	/* Últimas lecturas compensadas */
 	float temperature;             /**< Temperatura en grados Celsius */
-	float pressure;                /**< Presión en Pascales */
+	float pressure;                /**< Presión en hectopascales */
+
+	/* Últimas lecturas en formato entero (sólo con BMP280_COMP_INT) */
+	int32_t  temperatureInt;       /**< Temperatura en centésimas de grado Celsius */
+	uint32_t pressureInt;          /**< Presión en Pascales, formato Q24.8 */
+
+	/* Estado interno del driver (no modificar directamente) */
+	const bmp280_bus_t *bus;       /**< Transporte del sensor */
+	uint8_t cs;                    /**< Chip select (SPI) o dirección de esclavo (I2C) en el bus */
+	bmp280_comp_t comp;            /**< Algoritmo de compensación activo */
+	bmp280_config_t config;        /**< Configuración de medición activa */
+	uint8_t regConfig;             /**< Valor que tiene `config` en el sensor */
+	uint8_t regCtrlMeas;           /**< Valor que tiene `ctrl_meas` en el sensor (modo forced como SLEEP) */
+	uint8_t pendConfig;            /**< Valor pedido para `config`, escrito en el próximo volcado */
+	uint8_t pendCtrlMeas;          /**< Valor pedido para `ctrl_meas` */
+	uint8_t dirty;                 /**< Registros cuyo valor pedido aún no se escribió */
+	uint32_t verifyTick;           /**< Tick de la última relectura de ctrl_meas y config */
+	bmp280_calib_data_t calib;     /**< Calibración leída del sensor */
+	bmp280_calib_float_t calibF;   /**< Calibración escalada para BMP280_COMP_FLOAT_SP */
+	bmp280_stats_t stats;          /**< Contadores de instrumentación */
+	uint8_t speed;                 /**< Velocidad de SCK en uso (índice del puerto, 0 = la más lenta) */
+	uint8_t commErrors;            /**< Errores de comunicación desde la última muestra válida */
+	bmp280_ring_t *ring;           /**< Buffer donde se publica cada muestra (NULL: ninguno) */
+	bmp280_capture_hook_t capture; /**< Receptor de las ráfagas crudas (NULL: ninguno) */
+
+	/* Lectura asíncrona por DMA */
+	uint8_t txBuffer[BMP280_ASYNC_SIZE];
+	uint8_t rxBuffer[BMP280_ASYNC_SIZE];
+	volatile bool asyncPending;    /**< Ráfaga en curso, se libera en el callback del DMA */
+	bool asyncRetried;             /**< La ráfaga en curso ya es la repetición de una fallida */
+	volatile bmp280_port_status_t asyncResult; /**< Resultado de la última ráfaga */
 } bmp280_t;
 
 /**
  * @brief Inicializa el sensor BMP280.
  *
- * Esta función verifica la conexión con el sensor, lee su ID y aplica
- * la configuración almacenada en la estructura `bmp280_t`.
+ * Esta función verifica la conexión con el sensor, lee su ID, aplica la configuración
+ * por defecto y obtiene la calibración (de la caché persistente si hay una entrada válida,
+ * lo que acelera los reintentos desde el estado de error y los arranques en caliente). El descriptor queda asociado al chip select `cs`
+ * del bus SPI hasta que se vuelva a inicializar.
+ *
+ * Si el descriptor ya estaba asociado al mismo sensor (reintento tras un error), se conservan
+ * los contadores, la velocidad de SCK en uso, el algoritmo de compensación, el buffer de
+ * muestras y el receptor de capturas; el resto del estado vuelve a cero. En el primer uso el
+ * descriptor debe estar en cero (global, o inicializado con `{0}`).
+ *
+ * Nunca borra la memoria no volátil: si la caché de calibración está llena, el borrado del
+ * sector (del orden de 1 a 2 s) queda pendiente para ::BMP280_Cache_Service. La duración queda
+ * acotada por las transacciones del bus, el recorrido de la caché y la escritura de una entrada.
+ *
+ * @param dev Puntero a la estructura del sensor a inicializar.
+ * @param cs  Índice del chip select (0 ... BMP280_DEVICE_COUNT - 1).
+ * @return Estado de la operación (BMP280_OK si fue exitosa).
+ */
+bmp280_status_t BMP280_Init(bmp280_t *dev, uint8_t cs);
+
+/**
+ * @brief Inicializa un sensor conectado a un bus cualquiera.
+ *
+ * Igual que ::BMP280_Init, pero eligiendo el transporte. Con ::BMP280_Bus_I2C la lectura
+ * "por DMA" (::BMP280_Start_Read_Async) se resuelve de forma bloqueante, y el bus se comparte
+ * con el display.
  *
- * @param dev Puntero a la estructura de configuración del sensor.
+ * @param dev  Puntero a la estructura del sensor a inicializar.
+ * @param bus  Transporte (::BMP280_Bus_SPI o ::BMP280_Bus_I2C).
+ * @param addr Chip select (SPI) o dirección de esclavo, BMP280_I2C_ADDR_LOW o BMP280_I2C_ADDR_HIGH (I2C).
  * @return Estado de la operación (BMP280_OK si fue exitosa).
  */
-bmp280_status_t BMP280_Init(void);
+bmp280_status_t BMP280_Init_Bus(bmp280_t *dev, const bmp280_bus_t *bus, uint8_t addr);
 
 /**
  * @brief Dispara una medición en modo "forced".
  *
- * Esta función inicia una nueva medición si el sensor está en modo forzado.
+ * Esta función inicia una nueva medición si el sensor está en modo forzado. Si hay cambios
+ * de configuración pendientes, se escriben junto con el disparo en una única transacción.
  *
  * @param dev Puntero a la estructura del sensor.
  * @return Estado de la operación.
  */
-bmp280_status_t	BMP280_Trigger_Measurement(void);
+bmp280_status_t	BMP280_Trigger_Measurement(bmp280_t *dev);
 
 /**
  * @brief Verifica si el sensor sigue midiendo.
@@ -146,7 +337,7 @@ bmp280_status_t	BMP280_Trigger_Measurement(void);
  * @param dev Puntero a la estructura del sensor.
  * @return BMP280_DATA_RDY si los datos están listos, BMP280_DATA_NOT_RDY si no.
  */
-bmp280_status_t BMP280_Is_Measuring(void);
+bmp280_status_t BMP280_Is_Measuring(bmp280_t *dev);
 
 /**
  * @brief Lee y compensa los datos de presión y temperatura.
@@ -159,4 +350,320 @@ bmp280_status_t BMP280_Is_Measuring(void);
  */
 bmp280_status_t BMP280_Update_Parameters(bmp280_t* dev);
 
+/**
+ * @brief Asocia un buffer circular donde se publica cada muestra leída.
+ *
+ * A partir de la llamada, cada lectura exitosa se agrega al buffer con su marca de tiempo,
+ * sus valores crudos y compensados, además de actualizar los campos de `bmp280_t`. Los
+ * consumidores leen del buffer a su ritmo con ::BMP280_Ring_Pop sin frenar la adquisición.
+ * Se conserva al reinicializar el mismo sensor con ::BMP280_Init.
+ *
+ * @param dev  Puntero a la estructura del sensor.
+ * @param ring Buffer ya inicializado con ::BMP280_Ring_Init, o NULL para desasociarlo.
+ */
+void BMP280_Attach_Ring(bmp280_t *dev, bmp280_ring_t *ring);
+
+/**
+ * @brief Registra una función que recibe cada ráfaga cruda, para grabar capturas.
+ *
+ * La función se llama desde el contexto que completa la lectura, antes de compensar,
+ * con los 6 bytes tal como los entregó el sensor. Se conserva al reinicializar el mismo
+ * sensor con ::BMP280_Init, de modo que una captura en campo sobrevive a los reinicios completos.
+ *
+ * @param dev  Puntero a la estructura del sensor.
+ * @param hook Función receptora, o NULL para dejar de capturar.
+ */
+void BMP280_Set_Capture_Hook(bmp280_t *dev, bmp280_capture_hook_t hook);
+
+/**
+ * @brief Reconstruye el bloque crudo de calibración (registros 0x88 ... 0x9F) del sensor.
+ *
+ * Es el bloque que encabeza una captura, de modo que la reproducción use la misma calibración.
+ *
+ * @param dev Puntero a la estructura de un sensor ya inicializado.
+ * @param nvm Destino de BMP280_CALIB_SIZE bytes.
+ */
+void BMP280_Get_Calibration_Block(const bmp280_t *dev, uint8_t *nvm);
+
+/**
+ * @brief Descarta la calibración en caché y la vuelve a leer del sensor.
+ *
+ * ::BMP280_Init toma la calibración de la caché persistente cuando hay una entrada válida
+ * para el chip select; esta función fuerza la lectura por ráfaga y reescribe la entrada.
+ * Debe llamarse, por ejemplo, tras reemplazar físicamente el sensor.
+ *
+ * @param dev Puntero a la estructura de un sensor ya inicializado.
+ * @return BMP280_OK, o BMP280_ERROR_COMM si falló la lectura o la memoria.
+ */
+bmp280_status_t BMP280_Refresh_Calibration(bmp280_t *dev);
+
+/**
+ * @brief Sube la velocidad de SCK del sensor hasta la más rápida que funcione de forma confiable.
+ *
+ * Lee la calibración a la velocidad de arranque como referencia y luego prueba cada velocidad
+ * del puerto, de menor a mayor, leyendo BMP280_CLOCK_VALIDATE_READS veces el ID y el bloque de
+ * calibración (que debe coincidir por CRC-32). Se queda con la última velocidad que pasó todas
+ * las lecturas. Si después se acumulan BMP280_CLOCK_FALLBACK_ERRORS errores de comunicación sin
+ * una muestra válida, el driver baja solo una velocidad (ver `stats.clockFallbacks`).
+ *
+ * Llamar una vez, después del primer ::BMP280_Init: la velocidad elegida queda en el descriptor
+ * y la restituyen tanto los reintentos de ::BMP280_Init como ::BMP280_Recover, por lo que no hace
+ * falta volver a negociar (cada negociación relee la calibración varias veces por velocidad).
+ *
+ * @param dev Puntero a la estructura del sensor.
+ * @return BMP280_OK, o BMP280_ERROR_COMM si falló la lectura de referencia.
+ */
+bmp280_status_t BMP280_Negotiate_Clock(bmp280_t *dev);
+
+/**
+ * @brief Recupera el sensor tras un error sin pasar por ::BMP280_Init.
+ *
+ * Los errores aislados ya se absorben dentro del driver, que repite hasta BMP280_RETRY_COUNT
+ * veces cada transacción que falle (nivel 1). Si el error persiste, o si el sensor perdió la
+ * configuración (BMP280_ERROR_CONFIG, que no se arregla repitiendo), esta función escala:
+ *  - nivel 2: escribe CHIP_RESET en REG_RESET, espera que el sensor vuelva y le reescribe la
+ *    configuración activa (incluido NORMAL_MODE), conservando calibración, buffer y contadores;
+ *  - nivel 3: si lo anterior falla o hay una ráfaga por DMA colgada, reinicia el periférico del
+ *    bus (sólo si ningún otro sensor tiene una ráfaga en curso; si no, aborta únicamente la
+ *    propia), le restituye la velocidad de SCK negociada y repite el nivel 2.
+ * Si también falla, queda a la aplicación reintentar con espera creciente o llamar a ::BMP280_Init.
+ * Cada nivel se cuenta en ::bmp280_stats_t.
+ *
+ * @param dev Puntero a la estructura del sensor, ya inicializada.
+ * @return BMP280_OK si el sensor quedó midiendo con la configuración activa, BMP280_ERROR_COMM si no.
+ */
+bmp280_status_t BMP280_Recover(bmp280_t *dev);
+
+/**
+ * @brief Relee `ctrl_meas` y `config` y los compara con la copia del driver.
+ *
+ * Un corte de alimentación breve (brownout) devuelve el sensor a SLEEP con los registros en
+ * cero sin que el bus dé error; en NORMAL_MODE el driver seguiría leyendo la última
+ * conversión indefinidamente. ::BMP280_Read_If_Ready ya compara ambos registros en cada
+ * ráfaga; la lectura por DMA llama a esta función cada BMP280_VERIFY_PERIOD_MS.
+ *
+ * @param dev Puntero a la estructura del sensor.
+ * @return BMP280_OK si coinciden, BMP280_ERROR_CONFIG si el sensor perdió la configuración
+ *         (corresponde ::BMP280_Recover) o BMP280_ERROR_COMM si falló la lectura.
+ */
+bmp280_status_t BMP280_Verify_Registers(bmp280_t *dev);
+
+/**
+ * @brief Devuelve la frecuencia de SCK en uso para el sensor.
+ *
+ * @param dev Puntero a la estructura del sensor.
+ * @return Frecuencia en Hz (0 si el transporte no la conoce).
+ */
+uint32_t BMP280_Get_Clock_Hz(const bmp280_t *dev);
+
+/**
+ * @brief Consulta el estado y lee los datos en una única transacción SPI.
+ *
+ * Como los registros 0xF3 (status) a 0xFC (temp_xlsb) son contiguos, una sola ráfaga de
+ * 10 bytes trae status, ctrl_meas, config y los seis bytes de datos. Si el bit `measuring`
+ * está en 1 se descartan los datos; si no, se verifica que ctrl_meas y config coincidan con
+ * lo escrito por el driver (detecta un reinicio del sensor) y se compensan los datos.
+ * Reemplaza la secuencia ::BMP280_Is_Measuring + ::BMP280_Update_Parameters (dos transacciones).
+ *
+ * @param dev Puntero a la estructura del sensor. Al finalizar, contiene los nuevos datos.
+ * @return BMP280_OK si se actualizaron los valores, BMP280_DATA_NOT_RDY si el sensor aún mide,
+ *         BMP280_BUSY si el bus compartido estaba ocupado (no es un error; reintentar),
+ *         BMP280_ERROR_CONFIG si el sensor perdió la configuración, o BMP280_ERROR_COMM.
+ */
+bmp280_status_t BMP280_Read_If_Ready(bmp280_t *dev);
+
+/**
+ * @brief Aplica una configuración de medición en tiempo de ejecución.
+ *
+ * El driver guarda una copia de `ctrl_meas` y `config` y sólo escribe los registros cuyo
+ * contenido cambia: un cambio de sobremuestreo o de modo reescribe únicamente `ctrl_meas`,
+ * y un cambio de filtro o t_sb reescribe `config` (pasando antes por SLEEP si el sensor
+ * estaba en NORMAL_MODE, como exige la hoja de datos). Los registros modificados se
+ * escriben como pares registro/valor en una sola transacción. En modo forced la escritura
+ * se difiere hasta el próximo ::BMP280_Trigger_Measurement, que la agrega al disparo.
+ *
+ * @param dev Puntero a la estructura del sensor.
+ * @param cfg Configuración a aplicar.
+ * @return BMP280_OK, BMP280_ERROR_PARAM si algún campo no es válido o BMP280_ERROR_COMM.
+ */
+bmp280_status_t BMP280_Set_Config(bmp280_t *dev, const bmp280_config_t *cfg);
+
+/**
+ * @brief Obtiene la configuración de medición activa.
+ *
+ * @param dev Puntero a la estructura del sensor.
+ * @param cfg Estructura destino.
+ */
+void BMP280_Get_Config(const bmp280_t *dev, bmp280_config_t *cfg);
+
+/**
+ * @brief Aplica uno de los perfiles recomendados por la hoja de datos.
+ *
+ * Equivale a ::BMP280_Set_Config con la configuración del perfil.
+ *
+ * @param dev     Puntero a la estructura del sensor.
+ * @param profile Perfil a aplicar.
+ * @return BMP280_OK, BMP280_ERROR_PARAM si el perfil no existe o BMP280_ERROR_COMM.
+ */
+bmp280_status_t BMP280_Set_Profile(bmp280_t *dev, bmp280_profile_t profile);
+
+/**
+ * @brief Pasa el sensor a adquisición continua (NORMAL_MODE).
+ *
+ * El BMP280 alterna mediciones y períodos de reposo de duración `standby` por sí mismo,
+ * por lo que ya no es necesario disparar cada medición ni consultar el registro de estado:
+ * basta con una lectura por ráfaga por período (ver ::BMP280_Get_Period_Ms).
+ * Mientras esté activo, ::BMP280_Trigger_Measurement devuelve BMP280_ERROR_INVALID_MODE.
+ *
+ * @param dev     Puntero a la estructura del sensor.
+ * @param standby Tiempo de reposo entre mediciones (STANDBY_05 ... STANDBY_4000).
+ * @return BMP280_OK, BMP280_ERROR_PARAM si `standby` no es válido o BMP280_ERROR_COMM.
+ */
+bmp280_status_t BMP280_Start_Continuous(bmp280_t *dev, uint8_t standby);
+
+/**
+ * @brief Detiene la adquisición continua y vuelve al esquema de disparos en modo forced.
+ *
+ * @param dev Puntero a la estructura del sensor.
+ * @return BMP280_OK o BMP280_ERROR_COMM.
+ */
+bmp280_status_t BMP280_Stop_Continuous(bmp280_t *dev);
+
+/**
+ * @brief Devuelve el período de muestreo en modo continuo.
+ *
+ * Es la suma del tiempo de reposo configurado y el tiempo máximo de medición
+ * (::BMP280_Get_Measurement_Time_Us),
+ * redondeada hacia arriba, de modo que leer con ese período nunca repite una muestra.
+ *
+ * @param dev Puntero a la estructura del sensor.
+ * @return Período de adquisición en milisegundos.
+ */
+uint32_t BMP280_Get_Period_Ms(const bmp280_t *dev);
+
+/**
+ * @brief Calcula el tiempo máximo de conversión para la configuración activa.
+ *
+ * Aplica la fórmula de la hoja de datos (sección 9.1):
+ * t = 1,25 ms + 2,3 ms * osrs_t + (2,3 ms * osrs_p + 0,575 ms), omitiendo el término
+ * de cada magnitud que esté en SKIP. Tras ::BMP280_Trigger_Measurement, los datos están
+ * garantizados una vez transcurrido este tiempo, por lo que alcanza con una única lectura
+ * de STATUS como confirmación en lugar de consultarlo en cada vuelta del lazo.
+ *
+ * @param dev Puntero a la estructura del sensor.
+ * @return Tiempo máximo de medición en microsegundos.
+ */
+uint32_t BMP280_Get_Measurement_Time_Us(const bmp280_t *dev);
+
+/**
+ * @brief Igual que ::BMP280_Get_Measurement_Time_Us, redondeado hacia arriba a milisegundos.
+ *
+ * @param dev Puntero a la estructura del sensor.
+ * @return Tiempo máximo de medición en milisegundos.
+ */
+uint32_t BMP280_Get_Measurement_Time_Ms(const bmp280_t *dev);
+
+/**
+ * @brief Copia los contadores de instrumentación del driver.
+ *
+ * `statusReads / samples` da la cantidad de lecturas de STATUS por muestra y
+ * `transactions / samples` la cantidad de transacciones SPI por muestra.
+ *
+ * @param dev Puntero a la estructura del sensor.
+ * @param out Estructura destino.
+ */
+void BMP280_Get_Stats(const bmp280_t *dev, bmp280_stats_t *out);
+
+/**
+ * @brief Pone a cero los contadores de instrumentación.
+ *
+ * @param dev Puntero a la estructura del sensor.
+ */
+void BMP280_Reset_Stats(bmp280_t *dev);
+
+/**
+ * @brief Inicia la lectura por ráfaga de los datos crudos sin bloquear.
+ *
+ * Lanza por DMA la transferencia de 7 bytes desde REG_PRESS_MSB y retorna de inmediato.
+ * El resultado se obtiene luego con ::BMP280_Finish_Read_Async, de modo que la FSM
+ * puede seguir ejecutándose mientras los datos están en el bus. Los buffers de la
+ * ráfaga pertenecen al descriptor, por lo que no debe reinicializarse mientras tanto.
+ *
+ * @param dev Puntero a la estructura del sensor.
+ * @return BMP280_OK si la ráfaga comenzó, BMP280_ERROR_CONFIG si la relectura periódica de
+ *         ::BMP280_Verify_Registers detectó que el sensor perdió la configuración,
+ *         BMP280_BUSY si el bus lo tiene otro dispositivo (reintentar en la próxima pasada), o
+ *         BMP280_ERROR_COMM si la transferencia falló.
+ */
+bmp280_status_t BMP280_Start_Read_Async(bmp280_t *dev);
+
+/**
+ * @brief Completa una lectura iniciada con ::BMP280_Start_Read_Async.
+ *
+ * Si la ráfaga terminó, decodifica y compensa los datos igual que ::BMP280_Update_Parameters.
+ * Si falló, la vuelve a lanzar una vez (nivel 1 de recuperación, contado en `stats.retries`) y
+ * devuelve BMP280_DATA_NOT_RDY; sólo un segundo error seguido devuelve BMP280_ERROR_COMM.
+ *
+ * @param dev Puntero al descriptor del BMP280. La estructura se actualiza con los valores.
+ * @return BMP280_DATA_NOT_RDY si la transferencia sigue en curso, BMP280_OK si se actualizaron
+ *         los valores, o un código de error.
+ */
+bmp280_status_t BMP280_Finish_Read_Async(bmp280_t* dev);
+
+/**
+ * @brief Selecciona el algoritmo de compensación.
+ *
+ * Con `BMP280_COMP_INT` la compensación no utiliza la FPU: la temperatura se obtiene
+ * en centésimas de grado y la presión en Pa con 8 bits fraccionarios (Q24.8). Los campos
+ * flotantes de `bmp280_t` se siguen completando a partir de esos valores.
+ *
+ * Con `BMP280_COMP_FLOAT_SP` se usa la fórmula flotante reescrita para la FPU de simple
+ * precisión del Cortex-M4F: constantes con sufijo `f`, coeficientes escalados precalculados
+ * al leer la calibración y el único cociente dependiente de la muestra resuelto por Newton-Raphson.
+ *
+ * @param dev  Puntero a la estructura del sensor.
+ * @param mode Algoritmo a utilizar.
+ * @return BMP280_OK, o BMP280_ERROR_PARAM si el modo no es válido.
+ */
+bmp280_status_t BMP280_Set_Compensation(bmp280_t *dev, bmp280_comp_t mode);
+
+/**
+ * @brief Compensa un lote de muestras crudas en disposición de estructura de arreglos.
+ *
+ * Aplica la fórmula en simple precisión (la de `BMP280_COMP_FLOAT_SP`) con la calibración
+ * del sensor a `count` pares de valores crudos, escribiendo los resultados en arreglos
+ * separados de temperatura (°C) y presión (hPa). El cuerpo del lazo no tiene saltos ni
+ * llamadas, por lo que el compilador puede vectorizarlo (SSE/AVX en host); en el Cortex-M4F
+ * evita el costo por llamada y mantiene los coeficientes en registros de la FPU.
+ * No modifica `dev` ni valida cada muestra (una muestra cruda nula da un resultado sin sentido).
+ * Los cuatro arreglos no deben solaparse.
+ *
+ * @param dev         Sensor cuya calibración se usa.
+ * @param rawTemp     Temperaturas crudas (20 bits).
+ * @param rawPress    Presiones crudas (20 bits).
+ * @param temperature Destino de las temperaturas compensadas.
+ * @param pressure    Destino de las presiones compensadas.
+ * @param count       Cantidad de muestras.
+ * @return BMP280_OK, BMP280_ERROR_PARAM, o BMP280_ERROR_NAN si la calibración no es válida.
+ */
+bmp280_status_t BMP280_Compensate_Batch(const bmp280_t *dev, const uint32_t *restrict rawTemp, const uint32_t *restrict rawPress,
+                                        float *restrict temperature, float *restrict pressure, uint32_t count);
+
+#ifdef BMP280_BENCHMARK
+/**
+ * @brief Mide el costo en ciclos de cada algoritmo de compensación.
+ *
+ * Utiliza el vector de ejemplo de la hoja de datos (sección 8.2) como calibración,
+ * verifica que el camino entero devuelva exactamente los valores de referencia
+ * (T = 2508, P = 25767233), que el camino en simple precisión (escalar y por lotes) coincida con el entero
+ * dentro de 0,01 °C y 0,01 hPa, e imprime por SWO los ticks y nanosegundos por muestra
+ * de cada algoritmo (ciclos DWT en el target, ns con `BENCH_HOST`).
+ * No modifica la calibración leída del sensor.
+ *
+ * @param iterations Cantidad de compensaciones a medir por algoritmo.
+ * @return BMP280_OK, o BMP280_ERROR_SELF_TEST si el resultado no coincide.
+ */
+bmp280_status_t BMP280_Benchmark_Compensation(uint32_t iterations);
+#endif /* BMP280_BENCHMARK */
+
 #endif /* BMP280_INC_BMP280_H_ */
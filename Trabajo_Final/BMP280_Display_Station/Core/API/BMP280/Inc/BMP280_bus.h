@@ -0,0 +1,60 @@
+/**
+ * @file BMP280_bus.h
+ * @author Ing. Lucas Kirschner
+ * @date 15 Oct 2026
+ * @brief Interfaz de transporte del BMP280: acceso a registros independiente del bus.
+ *
+ * El driver sólo lee y escribe registros a través de un ::bmp280_bus_t; el armado de cada trama
+ * (bit de lectura y byte dummy en SPI, dirección de esclavo y registro en I2C) queda en la
+ * implementación del bus. Cada dispositivo elige el suyo en ::BMP280_Init_Bus, de modo que en
+ * una misma placa puede haber sensores en SPI y en I2C, y estos últimos pueden compartir el bus
+ * con el display (HD44780_port.c usa el mismo `hi2c1`).
+ */
+
+#ifndef BMP280_INC_BMP280_BUS_H_
+#define BMP280_INC_BMP280_BUS_H_
+
+#include <stdint.h>
+
+#include "BMP280_port.h"
+
+#define BMP280_I2C_ADDR_LOW		((uint8_t) 0x76)	/**< Dirección I2C con SDO a GND */
+#define BMP280_I2C_ADDR_HIGH	((uint8_t) 0x77)	/**< Dirección I2C con SDO a VDDIO */
+
+/**
+ * @brief Operaciones de un bus. `addr` es el chip select (SPI) o la dirección de esclavo (I2C).
+ */
+typedef struct
+{
+	/** Prepara el bus y el sensor para la primera transacción (velocidad de arranque), sin
+	 *  afectar las transferencias de otros sensores */
+	bmp280_port_status_t (*init)(uint8_t addr);
+
+	/** Reinicia el periférico para todos los sensores del bus. NULL si el bus no es propio
+	 *  (el I2C lo comparte el display) */
+	bmp280_port_status_t (*reset)(void);
+
+	/** Lee `size` registros contiguos desde `reg` */
+	bmp280_port_status_t (*read)(uint8_t addr, uint8_t reg, uint8_t *data, uint8_t size);
+
+	/** Escribe pares registro/valor (`size` par) en una sola transacción */
+	bmp280_port_status_t (*write)(uint8_t addr, const uint8_t *pairs, uint8_t size);
+
+	/** Inicia una lectura sin bloquear: `tx` y `rx` tienen `size + 1` bytes y los datos quedan en
+	 *  `rx[1]` ... `rx[size]` al invocarse ::BMP280_Transfer_Complete_Callback. NULL si el bus no
+	 *  la admite; el driver lee entonces de forma bloqueante */
+	bmp280_port_status_t (*readAsync)(uint8_t addr, uint8_t reg, uint8_t *tx, uint8_t *rx, uint8_t size);
+
+	/** Velocidades de reloj disponibles (ver ::BMP280_Port_Speed_Count) */
+	uint8_t (*speedCount)(void);
+	bmp280_port_status_t (*setSpeed)(uint8_t addr, uint8_t speed);
+	uint32_t (*speedHz)(uint8_t speed);
+
+	uint8_t minAddr;               /**< Primera dirección válida */
+	uint8_t maxAddr;               /**< Última dirección válida */
+} bmp280_bus_t;
+
+extern const bmp280_bus_t BMP280_Bus_SPI;	/**< SPI3 con la tabla de chip selects del puerto */
+extern const bmp280_bus_t BMP280_Bus_I2C;	/**< I2C1, compartido con el display */
+
+#endif /* BMP280_INC_BMP280_BUS_H_ */
@@ -0,0 +1,81 @@
+/**
+ * @file BMP280_cache.h
+ * @author Ing. Lucas Kirschner
+ * @date 15 Oct 2026
+ * @brief Caché persistente de la calibración del BMP280 en memoria no volátil.
+ *
+ * Guarda el bloque crudo de calibración (registros 0x88 ... 0x9F) en la región del módulo
+ * NVM, indexado por chip select e ID del chip y protegido por un CRC-32, de modo que un
+ * arranque en caliente o un reintento de inicialización evita la lectura por ráfaga.
+ *
+ * Los registros se agregan uno tras otro en la región; uno nuevo invalida al anterior con la
+ * misma clave apagando su palabra mágica, y la región sólo se borra cuando se llena. Ese borrado
+ * (un sector de 128 KB, del orden de 1 a 2 s en el target) nunca se hace dentro de
+ * ::BMP280_Cache_Store: la entrada queda en RAM y la aplicación lo ejecuta en un momento ocioso
+ * con ::BMP280_Cache_Service.
+ * El ID del BMP280 es fijo (0x58), por lo que si se reemplaza físicamente un sensor se debe
+ * invalidar su entrada (::BMP280_Cache_Invalidate o ::BMP280_Refresh_Calibration).
+ */
+
+#ifndef BMP280_INC_BMP280_CACHE_H_
+#define BMP280_INC_BMP280_CACHE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "BMP280.h"
+
+#define BMP280_CACHE_ALL		((uint8_t) 0xFF)	/**< Invalida las entradas de todos los chip selects */
+
+/**
+ * @brief Busca la calibración de un sensor en la caché.
+ *
+ * @param cs     Chip select del sensor.
+ * @param chipId ID leído del sensor.
+ * @param nvm    Destino del bloque crudo de BMP280_CALIB_SIZE bytes.
+ * @return true si se encontró una entrada válida (clave y CRC correctos).
+ */
+bool BMP280_Cache_Load(uint8_t cs, uint8_t chipId, uint8_t *nvm);
+
+/**
+ * @brief Guarda la calibración de un sensor, invalidando la entrada anterior.
+ *
+ * Si la región está llena no la borra: guarda la entrada en RAM (una sola; la última reemplaza a
+ * la anterior) y deja el borrado pendiente para ::BMP280_Cache_Service.
+ *
+ * @param cs     Chip select del sensor.
+ * @param chipId ID leído del sensor.
+ * @param nvm    Bloque crudo de BMP280_CALIB_SIZE bytes.
+ * @return BMP280_OK, o BMP280_ERROR_COMM si falló la escritura en la memoria.
+ */
+bmp280_status_t BMP280_Cache_Store(uint8_t cs, uint8_t chipId, const uint8_t *nvm);
+
+/**
+ * @brief Invalida las entradas de un chip select.
+ *
+ * @param cs Chip select, o BMP280_CACHE_ALL para vaciar la caché completa.
+ * @return BMP280_OK, o BMP280_ERROR_COMM si falló la escritura en la memoria.
+ */
+bmp280_status_t BMP280_Cache_Invalidate(uint8_t cs);
+
+/**
+ * @brief Ejecuta el borrado pendiente de la región y escribe la entrada que esperaba en RAM.
+ *
+ * Sin borrado pendiente retorna de inmediato. Con uno pendiente bloquea lo que tarde el borrado
+ * del sector (del orden de 1 a 2 s en el target, con la CPU detenida si ejecuta desde la misma
+ * flash), por lo que se debe llamar donde esa demora no afecte a nadie.
+ *
+ * @return BMP280_OK, o BMP280_ERROR_COMM si falló el borrado o la escritura.
+ */
+bmp280_status_t BMP280_Cache_Service(void);
+
+/**
+ * @brief CRC-32 (polinomio 0xEDB88320, reflejado) sin tabla, usado para validar bloques de calibración.
+ *
+ * @param data Datos a proteger.
+ * @param size Cantidad de bytes.
+ * @return CRC de los datos.
+ */
+uint32_t BMP280_Cache_Crc32(const uint8_t *data, uint32_t size);
+
+#endif /* BMP280_INC_BMP280_CACHE_H_ */
@@ -0,0 +1,123 @@
+/**
+ * @file BMP280_capture.h
+ * @author Ing. Lucas Kirschner
+ * @date 15 Oct 2026
+ * @brief Formato binario de captura de datos crudos del BMP280 y su reproducción en host.
+ *
+ * Una captura permite reproducir fuera del micro exactamente lo que leyó el sensor en campo.
+ * Todos los campos multibyte son little-endian.
+ *
+ * Encabezado (BMP280_CAPTURE_HEADER_SIZE = 32 bytes, una sola vez):
+ *  - [0..3]   "BMPC"
+ *  - [4]      versión (BMP280_CAPTURE_VERSION)
+ *  - [5]      ID del chip
+ *  - [6..7]   reservados, en 0
+ *  - [8..31]  registros de calibración 0x88 ... 0x9F tal como se leyeron
+ *
+ * Registro (BMP280_CAPTURE_RECORD_SIZE = 10 bytes, uno por muestra):
+ *  - [0..3]   tick de la lectura (ms)
+ *  - [4..9]   ráfaga cruda press_msb ... temp_xlsb
+ *
+ * Para grabar, se escribe el encabezado con ::BMP280_Get_Calibration_Block y se registra con
+ * ::BMP280_Set_Capture_Hook una función que agregue cada registro al medio de almacenamiento.
+ *
+ * Para reproducir, se compila el driver en host con `BMP280_PORT_REPLAY` (en lugar de
+ * BMP280_port.c se usa BMP280_port_replay.c) y se carga la captura con ::BMP280_Replay_Load
+ * o ::BMP280_Replay_Open. El transporte emula el mapa de registros: el ID y la calibración salen
+ * del encabezado, y cada lectura que incluya 0xF7 ... 0xFC consume el siguiente registro, por lo
+ * que toda la cadena (Init, FSM, compensación, buffer de muestras) corre sin cambios. Por ejemplo:
+ *
+ *   gcc -O2 -DBMP280_PORT_REPLAY -DNVM_HOST -DBMP280_PRINT_SAMPLES=0 -ICore/API/BMP280/Inc
+ *       -ICore/API/NVM/Inc -ICore/API/SWO/Inc Core/API/BMP280/Src/BMP280.c
+ *       Core/API/BMP280/Src/BMP280_cache.c Core/API/BMP280/Src/BMP280_ring.c
+ *       Core/API/BMP280/Src/BMP280_capture.c Core/API/BMP280/Src/BMP280_port_replay.c
+ *       Core/API/BMP280/Src/BMP280_bus.c Core/API/NVM/Src/NVM.c replay_main.c
+ */
+
+#ifndef BMP280_INC_BMP280_CAPTURE_H_
+#define BMP280_INC_BMP280_CAPTURE_H_
+
+#include <stdint.h>
+
+#include "BMP280.h"
+
+#define BMP280_CAPTURE_VERSION		((uint8_t) 1)
+#define BMP280_CAPTURE_HEADER_SIZE	(8 + BMP280_CALIB_SIZE)
+#define BMP280_CAPTURE_RECORD_SIZE	(4 + BMP280_DATA_SIZE)
+
+/**
+ * @brief Arma el encabezado de una captura.
+ *
+ * @param buf    Destino de BMP280_CAPTURE_HEADER_SIZE bytes.
+ * @param chipId ID del sensor.
+ * @param nvm    Bloque de calibración (::BMP280_Get_Calibration_Block).
+ */
+void BMP280_Capture_Write_Header(uint8_t *buf, uint8_t chipId, const uint8_t *nvm);
+
+/**
+ * @brief Arma un registro de muestra.
+ *
+ * @param buf  Destino de BMP280_CAPTURE_RECORD_SIZE bytes.
+ * @param tick Tick de la lectura.
+ * @param raw  Ráfaga cruda de BMP280_DATA_SIZE bytes.
+ */
+void BMP280_Capture_Write_Record(uint8_t *buf, uint32_t tick, const uint8_t *raw);
+
+/**
+ * @brief Valida y decodifica el encabezado de una captura.
+ *
+ * @param buf    Inicio de la captura.
+ * @param size   Tamaño disponible en bytes.
+ * @param chipId Destino del ID del sensor.
+ * @param nvm    Destino del bloque de calibración (BMP280_CALIB_SIZE bytes).
+ * @return BMP280_OK, o BMP280_ERROR_PARAM si el encabezado no es válido.
+ */
+bmp280_status_t BMP280_Capture_Read_Header(const uint8_t *buf, uint32_t size, uint8_t *chipId, uint8_t *nvm);
+
+/**
+ * @brief Decodifica un registro de muestra.
+ *
+ * @param buf  Inicio del registro.
+ * @param tick Destino del tick.
+ * @param raw  Destino de la ráfaga cruda (BMP280_DATA_SIZE bytes).
+ */
+void BMP280_Capture_Read_Record(const uint8_t *buf, uint32_t *tick, uint8_t *raw);
+
+#ifdef BMP280_PORT_REPLAY
+/**
+ * @brief Carga una captura en memoria como fuente del transporte de reproducción.
+ *
+ * El buffer no se copia y debe permanecer válido mientras se reproduce.
+ *
+ * @param data Captura completa (encabezado y registros).
+ * @param size Tamaño en bytes; un registro incompleto al final se ignora.
+ * @return BMP280_OK, o BMP280_ERROR_PARAM si el encabezado no es válido.
+ */
+bmp280_status_t BMP280_Replay_Load(const uint8_t *data, uint32_t size);
+
+/**
+ * @brief Lee un archivo de captura completo a memoria y lo carga con ::BMP280_Replay_Load.
+ *
+ * Si falla, la captura cargada anteriormente sigue activa.
+ *
+ * @param path Ruta del archivo.
+ * @return BMP280_OK, BMP280_ERROR_COMM si no se pudo leer o BMP280_ERROR_PARAM si no es válido.
+ */
+bmp280_status_t BMP280_Replay_Open(const char *path);
+
+/**
+ * @brief Vuelve al primer registro de la captura cargada.
+ */
+void BMP280_Replay_Rewind(void);
+
+/**
+ * @brief Devuelve cuántos registros quedan por reproducir.
+ *
+ * Al agotarse, las lecturas de datos fallan con BMP280_PORT_ERROR.
+ *
+ * @return Registros restantes.
+ */
+uint32_t BMP280_Replay_Remaining(void);
+#endif /* BMP280_PORT_REPLAY */
+
+#endif /* BMP280_INC_BMP280_CAPTURE_H_ */
@@ -12,6 +12,17 @@
 #define BMP280_INC_BMP280_PORT_H_
 
 #include <stdint.h>
+#include <stdbool.h>
+
+/* Transportes de host: reemplazan a BMP280_port.c para compilar el driver fuera del micro */
+#if defined(BMP280_PORT_REPLAY) || defined(BMP280_PORT_SIM)
+#define BMP280_PORT_HOST
+#endif
+
+#define BMP280_DEVICE_COUNT	1			/**< Cantidad de sensores en el bus (entradas de la tabla de CS) */
+#define BMP280_SPI_MAX_HZ	10000000u	/**< Máxima frecuencia de SCK admitida por el BMP280 */
+
+#ifndef BMP280_PORT_HOST
 
 #include "stm32f4xx_hal.h" 				/**< Cambiar según el HAL de la plataforma utilizada */
 
@@ -19,6 +30,11 @@
 #define SPI3_CS_GPIO_Port   GPIOD       /**< Puerto CS del BMP280, ajustar según hardware */
 
 extern SPI_HandleTypeDef hspi3;			/**< SPI usado para el BMP280 (ajustar según interfaz usada) */
+extern DMA_HandleTypeDef hdma_spi3_rx;	/**< DMA1 Stream0 Canal 0: SPI3_RX */
+extern DMA_HandleTypeDef hdma_spi3_tx;	/**< DMA1 Stream5 Canal 0: SPI3_TX */
+extern I2C_HandleTypeDef hi2c1;			/**< I2C para sensores en ese bus, compartido con el display */
+
+#endif /* BMP280_PORT_HOST */
 
 
 /**
@@ -28,42 +44,183 @@ typedef enum
 {
     BMP280_PORT_OK = 0,      /**< Operación exitosa */
     BMP280_PORT_ERROR,       /**< Error en la comunicación */
+    BMP280_PORT_BUSY,        /**< Hay una transferencia asíncrona en curso */
 } bmp280_port_status_t;
 
 /**
  * @brief Inicializa la interfaz usada por el BMP280.
  *
- * Esta función puede incluir configuraciones específicas del periférico SPI si fuera necesario.
- * En esta implementación, se asume que la inicialización se realiza externamente mediante la HAL.
+ * Reinicia el periférico SPI y sus streams de DMA para todo el bus. Si había una transferencia
+ * por DMA en curso, se aborta y se notifica al sensor dueño mediante
+ * ::BMP280_Transfer_Complete_Callback con BMP280_PORT_ERROR.
  */
 bmp280_port_status_t BMP280_Port_Init(void);
 
+/**
+ * @brief Prepara el bus para un sensor sin afectar a los demás.
+ *
+ * La primera vez inicializa el periférico con ::BMP280_Port_Init; después sólo aborta una
+ * transferencia por DMA del propio sensor (notificándola con BMP280_PORT_ERROR), lo deselecciona
+ * y lo deja en la velocidad de arranque. Una transferencia de otro sensor sigue su curso.
+ *
+ * @param cs Índice del chip select del sensor.
+ * @return BMP280_PORT_OK si el sensor quedó listo, BMP280_PORT_ERROR si no.
+ */
+bmp280_port_status_t BMP280_Port_Init_Device(uint8_t cs);
+
 /**
  * @brief Envía datos al sensor BMP280 vía SPI.
  *
+ * @param cs Índice del chip select del sensor.
  * @param dataWrite Puntero al buffer de datos a transmitir.
  * @param size Cantidad de bytes a transmitir.
  * @return Estado de la operación (OK, ERROR o TIMEOUT).
  */
-bmp280_port_status_t BMP280_Write(uint8_t *dataWrite, uint8_t size);
+bmp280_port_status_t BMP280_Write(uint8_t cs, uint8_t *dataWrite, uint8_t size);
 
 /**
  * @brief Recibe datos desde el sensor BMP280 vía SPI.
  *
+ * @param cs Índice del chip select del sensor.
  * @param dataRead Puntero al buffer donde se almacenarán los datos recibidos.
  * @param size Cantidad de bytes a recibir.
  * @return Estado de la operación (OK, ERROR o TIMEOUT).
  */
-bmp280_port_status_t BMP280_Read(uint8_t *dataRead, uint8_t size);
+bmp280_port_status_t BMP280_Read(uint8_t cs, uint8_t *dataRead, uint8_t size);
 
 /**
  * @brief Realiza una transferencia SPI completa (transmisión + recepción).
  *
+ * @param cs Índice del chip select del sensor.
  * @param dataWrite Puntero al buffer de datos a transmitir.
  * @param dataRead Puntero al buffer donde se almacenarán los datos recibidos.
  * @param size Cantidad de bytes a transferir.
  * @return Estado de la operación (OK, ERROR o TIMEOUT).
  */
-bmp280_port_status_t BMP280_Transfer(uint8_t *dataWrite, uint8_t *dataRead, uint8_t size);
+bmp280_port_status_t BMP280_Transfer(uint8_t cs, uint8_t *dataWrite, uint8_t *dataRead, uint8_t size);
+
+/**
+ * @brief Inicia una transferencia SPI (transmisión + recepción) por DMA sin bloquear.
+ *
+ * Baja el CS y devuelve el control inmediatamente. Al finalizar la transferencia,
+ * desde la interrupción del DMA, se libera el CS y se invoca
+ * ::BMP280_Transfer_Complete_Callback. Los buffers deben permanecer válidos
+ * hasta ese momento. Mientras la transferencia esté en curso, las funciones
+ * bloqueantes del puerto devuelven `BMP280_PORT_BUSY`, sea cual sea el CS pedido,
+ * ya que todos los sensores comparten el bus.
+ *
+ * @param cs Índice del chip select del sensor.
+ * @param dataWrite Puntero al buffer de datos a transmitir.
+ * @param dataRead Puntero al buffer donde se almacenarán los datos recibidos.
+ * @param size Cantidad de bytes a transferir.
+ * @return BMP280_PORT_OK si la transferencia comenzó, BMP280_PORT_BUSY si ya había
+ *         una en curso o BMP280_PORT_ERROR ante un error.
+ */
+bmp280_port_status_t BMP280_Transfer_Async(uint8_t cs, uint8_t *dataWrite, uint8_t *dataRead, uint8_t size);
+
+/**
+ * @brief Indica si hay una transferencia asíncrona en curso.
+ *
+ * @return true mientras el DMA no haya finalizado.
+ */
+bool BMP280_Port_Is_Busy(void);
+
+/**
+ * @brief Devuelve la cantidad de velocidades de SCK disponibles.
+ *
+ * Las velocidades se numeran desde 0 (la más lenta, con la que arranca cada sensor) hacia
+ * arriba, y sólo se cuentan las que no superan BMP280_SPI_MAX_HZ.
+ *
+ * @return Cantidad de velocidades (al menos 1).
+ */
+uint8_t BMP280_Port_Speed_Count(void);
+
+/**
+ * @brief Elige la velocidad de SCK con la que se habla con un sensor.
+ *
+ * El cambio se aplica al bajar su CS en la próxima transferencia, por lo que cada sensor del
+ * bus puede tener su propia velocidad y el llamado es seguro con una ráfaga por DMA en curso.
+ *
+ * @param cs    Índice del chip select del sensor.
+ * @param speed Velocidad, de 0 a ::BMP280_Port_Speed_Count - 1.
+ * @return BMP280_PORT_OK, o BMP280_PORT_ERROR si algún parámetro está fuera de rango.
+ */
+bmp280_port_status_t BMP280_Port_Set_Speed(uint8_t cs, uint8_t speed);
+
+/**
+ * @brief Devuelve la frecuencia de SCK de una velocidad.
+ *
+ * @param speed Velocidad, de 0 a ::BMP280_Port_Speed_Count - 1.
+ * @return Frecuencia en Hz, o 0 si está fuera de rango.
+ */
+uint32_t BMP280_Port_Get_Speed_Hz(uint8_t speed);
+
+/**
+ * @brief Devuelve la base de tiempo usada para marcar las muestras.
+ *
+ * @return Milisegundos desde el arranque.
+ */
+uint32_t BMP280_Port_Get_Tick(void);
+
+/**
+ * @brief Espera bloqueante, para los plazos cortos de la hoja de datos (p. ej. el arranque
+ *        tras un reset por software).
+ *
+ * @param ms Milisegundos a esperar.
+ */
+void BMP280_Port_Delay_Ms(uint32_t ms);
+
+/**
+ * @brief Prepara el I2C usado por los sensores conectados a ese bus.
+ *
+ * Si el bus ya fue inicializado (p. ej. por HD44780_Port_Init) se lo comparte tal cual.
+ *
+ * @return BMP280_PORT_OK si el bus quedó listo.
+ */
+bmp280_port_status_t BMP280_I2C_Init(void);
+
+/**
+ * @brief Lee registros contiguos de un sensor por I2C (escritura de la dirección y repeated start).
+ *
+ * Si el display está volcando su framebuffer por DMA (ver I2C_BUS.h) no espera: devuelve
+ * BMP280_PORT_BUSY en el acto y el driver lo informa como BMP280_BUSY, sin contarlo como error.
+ *
+ * @param addr Dirección de esclavo de 7 bits.
+ * @param reg  Primer registro.
+ * @param data Destino de `size` bytes.
+ * @param size Cantidad de registros.
+ * @return Estado de la operación.
+ */
+bmp280_port_status_t BMP280_I2C_Read(uint8_t addr, uint8_t reg, uint8_t *data, uint8_t size);
+
+/**
+ * @brief Envía bytes a un sensor por I2C en una sola transacción.
+ *
+ * Como ::BMP280_I2C_Read, devuelve BMP280_PORT_BUSY en el acto si el display tiene el bus.
+ *
+ * @param addr Dirección de esclavo de 7 bits.
+ * @param data Bytes a enviar (pares registro/valor).
+ * @param size Cantidad de bytes.
+ * @return Estado de la operación.
+ */
+bmp280_port_status_t BMP280_I2C_Write(uint8_t addr, const uint8_t *data, uint8_t size);
+
+/**
+ * @brief Devuelve la frecuencia de SCL del bus I2C.
+ *
+ * @return Frecuencia en Hz.
+ */
+uint32_t BMP280_I2C_Get_Clock_Hz(void);
+
+/**
+ * @brief Notificación de fin de una transferencia iniciada con ::BMP280_Transfer_Async.
+ *
+ * Se ejecuta en contexto de interrupción, con el CS ya liberado. El puerto provee
+ * una implementación débil vacía; el driver la redefine para registrar el resultado.
+ *
+ * @param cs     Chip select de la transferencia finalizada.
+ * @param status BMP280_PORT_OK si la transferencia fue exitosa, BMP280_PORT_ERROR si no.
+ */
+void BMP280_Transfer_Complete_Callback(uint8_t cs, bmp280_port_status_t status);
 
 #endif /* BMP280_INC_BMP280_PORT_H_ */
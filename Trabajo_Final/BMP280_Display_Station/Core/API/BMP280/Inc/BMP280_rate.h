@@ -0,0 +1,120 @@
+/**
+ * @file BMP280_rate.h
+ * @author Ing. Lucas Kirschner
+ * @date 15 Oct 2026
+ * @brief Control adaptivo del período de muestreo y del sobremuestreo según la dinámica de la señal.
+ *
+ * La política define BMP280_RATE_LEVELS niveles, del más lento y económico (período largo,
+ * sobremuestreo x1) al más rápido. Con cada muestra se estima la velocidad de cambio de la
+ * presión y de la temperatura sobre una ventana de al menos `spanMs`, de modo que el ruido de
+ * una muestra no se confunda con un evento aunque el período sea corto:
+ *  - si alguna supera su umbral de subida, se salta directamente al nivel más rápido;
+ *  - si ambas quedan por debajo de su umbral de bajada durante `stableSamples` estimaciones
+ *    seguidas, se baja un nivel; entre ambos umbrales se mantiene el nivel (histéresis).
+ *
+ * En modo forced, el cambio de sobremuestreo lo escribe el próximo disparo (sin transacciones
+ * extra, ver ::BMP280_Set_Config); en NORMAL_MODE también cambia t_sb.
+ */
+
+#ifndef BMP280_INC_BMP280_RATE_H_
+#define BMP280_INC_BMP280_RATE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "BMP280.h"
+#include "BMP280_ring.h"
+
+#define BMP280_RATE_LEVELS		3u		/**< Niveles de la política (0 = el más lento) */
+
+/**
+ * @brief Parámetros de adquisición de un nivel.
+ */
+typedef struct
+{
+	uint32_t periodMs;             /**< Período entre disparos en modo forced */
+	uint8_t osrsT;                 /**< Sobremuestreo de temperatura (TEMP_OVER_xN) */
+	uint8_t osrsP;                 /**< Sobremuestreo de presión (PRESS_OVER_xN) */
+	uint8_t standby;               /**< t_sb en NORMAL_MODE (STANDBY_N) */
+} bmp280_rate_level_t;
+
+/**
+ * @brief Política del controlador.
+ */
+typedef struct
+{
+	bmp280_rate_level_t levels[BMP280_RATE_LEVELS]; /**< Del más lento al más rápido */
+	float pressRise;               /**< |dp/dt| que dispara el nivel más rápido (hPa/s) */
+	float pressFall;               /**< |dp/dt| por debajo del cual la presión se considera estable (hPa/s) */
+	float tempRise;                /**< |dT/dt| que dispara el nivel más rápido (°C/s) */
+	float tempFall;                /**< |dT/dt| por debajo del cual la temperatura se considera estable (°C/s) */
+	uint32_t spanMs;               /**< Intervalo mínimo de cada estimación de la derivada */
+	uint8_t stableSamples;         /**< Estimaciones estables seguidas antes de bajar un nivel */
+} bmp280_rate_policy_t;
+
+/**
+ * @brief Estado del controlador.
+ */
+typedef struct
+{
+	const bmp280_rate_policy_t *policy; /**< Política en uso */
+	uint8_t level;                 /**< Nivel actual */
+	uint8_t stableCount;           /**< Estimaciones estables seguidas */
+	bool primed;                   /**< Hay una muestra de referencia */
+	uint32_t refTick;              /**< Muestra de referencia de la derivada */
+	float refPress;
+	float refTemp;
+	float pressRate;               /**< Última |dp/dt| estimada (hPa/s) */
+	float tempRate;                /**< Última |dT/dt| estimada (°C/s) */
+
+	/* Contadores */
+	uint32_t samples;              /**< Muestras procesadas */
+	uint32_t escalations;          /**< Subidas al nivel más rápido */
+	uint32_t relaxations;          /**< Bajadas de un nivel */
+	uint32_t levelSamples[BMP280_RATE_LEVELS]; /**< Muestras tomadas en cada nivel */
+} bmp280_rate_t;
+
+/**
+ * @brief Política por defecto: 5 s x1/x1, 1 s x1/x4 y 100 ms x2/x8, con umbrales de subida de
+ *        0,05 hPa/s (≈ 0,4 m/s de ascenso) y 0,1 °C/s.
+ */
+extern const bmp280_rate_policy_t BMP280_Rate_Default_Policy;
+
+/**
+ * @brief Inicializa el controlador en el nivel más lento.
+ *
+ * @param rate   Controlador a inicializar.
+ * @param policy Política, que debe permanecer válida (NULL: ::BMP280_Rate_Default_Policy).
+ * @return BMP280_OK o BMP280_ERROR_PARAM si la política no es coherente.
+ */
+bmp280_status_t BMP280_Rate_Init(bmp280_rate_t *rate, const bmp280_rate_policy_t *policy);
+
+/**
+ * @brief Procesa una muestra y decide el nivel.
+ *
+ * @param rate   Controlador.
+ * @param sample Muestra leída del buffer del driver.
+ * @return true si el nivel cambió (corresponde ::BMP280_Rate_Apply).
+ */
+bool BMP280_Rate_Update(bmp280_rate_t *rate, const bmp280_sample_t *sample);
+
+/**
+ * @brief Aplica al sensor el sobremuestreo del nivel actual (y t_sb, si está en NORMAL_MODE).
+ *
+ * Conserva el modo y el filtro del sensor.
+ *
+ * @param rate Controlador.
+ * @param dev  Sensor.
+ * @return Resultado de ::BMP280_Set_Config.
+ */
+bmp280_status_t BMP280_Rate_Apply(const bmp280_rate_t *rate, bmp280_t *dev);
+
+/**
+ * @brief Devuelve los parámetros del nivel actual.
+ *
+ * @param rate Controlador.
+ * @return Nivel en uso.
+ */
+const bmp280_rate_level_t *BMP280_Rate_Get_Level(const bmp280_rate_t *rate);
+
+#endif /* BMP280_INC_BMP280_RATE_H_ */
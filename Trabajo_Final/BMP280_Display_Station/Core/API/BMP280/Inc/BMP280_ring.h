@@ -0,0 +1,100 @@
+/**
+ * @file BMP280_ring.h
+ * @author Ing. Lucas Kirschner
+ * @date 15 Oct 2026
+ * @brief Buffer circular de muestras con marca de tiempo entre la adquisición y sus consumidores.
+ *
+ * Un único productor (el driver, o el callback de fin de SPI) agrega muestras sin bloquearse
+ * nunca: si el buffer está lleno, sobrescribe la más vieja. Cada consumidor (display,
+ * telemetría, registro) tiene su propio lector con su índice y su contador de desbordes, de modo
+ * que cada uno lee a su ritmo y la relación productor/lector es siempre de un solo productor y
+ * un solo consumidor, sin necesidad de deshabilitar interrupciones.
+ */
+
+#ifndef BMP280_INC_BMP280_RING_H_
+#define BMP280_INC_BMP280_RING_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define BMP280_RING_SIZE		16u		/**< Ranuras del buffer, potencia de dos; cada lector retiene hasta SIZE - 1 muestras */
+
+/**
+ * @brief Muestra almacenada en el buffer.
+ */
+typedef struct
+{
+	uint32_t timestamp;            /**< Instante de la lectura (HAL_GetTick, ms) */
+	uint32_t rawTemp;              /**< Temperatura cruda (20 bits) */
+	uint32_t rawPress;             /**< Presión cruda (20 bits) */
+	float temperature;             /**< Temperatura compensada en grados Celsius */
+	float pressure;                /**< Presión compensada en hectopascales */
+	uint8_t cs;                    /**< Chip select del sensor que la generó */
+} bmp280_sample_t;
+
+/**
+ * @brief Buffer circular. Sólo lo modifica el productor.
+ */
+typedef struct
+{
+	bmp280_sample_t slots[BMP280_RING_SIZE];
+	volatile uint32_t head;        /**< Cantidad total de muestras agregadas (se desborda sin problema) */
+} bmp280_ring_t;
+
+/**
+ * @brief Estado de un consumidor. Sólo lo modifica su consumidor.
+ */
+typedef struct
+{
+	uint32_t tail;                 /**< Próxima muestra a leer, en la misma cuenta que `head` */
+	uint32_t overruns;             /**< Muestras perdidas por no leer a tiempo */
+} bmp280_ring_reader_t;
+
+/**
+ * @brief Inicializa un buffer vacío.
+ *
+ * @param ring Buffer a inicializar.
+ */
+void BMP280_Ring_Init(bmp280_ring_t *ring);
+
+/**
+ * @brief Agrega una muestra, sobrescribiendo la más vieja si el buffer está lleno.
+ *
+ * No bloquea y puede llamarse desde una interrupción, siempre que haya un único productor.
+ *
+ * @param ring   Buffer destino.
+ * @param sample Muestra a agregar.
+ */
+void BMP280_Ring_Push(bmp280_ring_t *ring, const bmp280_sample_t *sample);
+
+/**
+ * @brief Registra un consumidor, que leerá a partir de la próxima muestra que se agregue.
+ *
+ * @param ring   Buffer a leer.
+ * @param reader Estado del consumidor.
+ */
+void BMP280_Ring_Reader_Init(const bmp280_ring_t *ring, bmp280_ring_reader_t *reader);
+
+/**
+ * @brief Devuelve cuántas muestras tiene pendientes un consumidor (como máximo BMP280_RING_SIZE - 1).
+ *
+ * @param ring   Buffer.
+ * @param reader Estado del consumidor.
+ * @return Cantidad de muestras disponibles.
+ */
+uint32_t BMP280_Ring_Available(const bmp280_ring_t *ring, const bmp280_ring_reader_t *reader);
+
+/**
+ * @brief Lee la muestra más vieja pendiente para un consumidor.
+ *
+ * Si el productor sobrescribió muestras que el consumidor no llegó a leer, se saltean y se
+ * suman a `reader->overruns`.
+ *
+ * @param ring   Buffer.
+ * @param reader Estado del consumidor.
+ * @param sample Destino de la muestra.
+ * @return true si se leyó una muestra, false si no había pendientes.
+ */
+bool BMP280_Ring_Pop(const bmp280_ring_t *ring, bmp280_ring_reader_t *reader, bmp280_sample_t *sample);
+
+#endif /* BMP280_INC_BMP280_RING_H_ */
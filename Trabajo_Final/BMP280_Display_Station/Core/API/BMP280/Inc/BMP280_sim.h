@@ -0,0 +1,118 @@
+/**
+ * @file BMP280_sim.h
+ * @author Ing. Lucas Kirschner
+ * @date 15 Oct 2026
+ * @brief Simulador del BMP280 a nivel de registros para compilaciones de host.
+ *
+ * Al compilar con `BMP280_PORT_SIM`, BMP280_port_sim.c implementa BMP280_port.h sobre un
+ * modelo del sensor: ID, reset, ctrl_meas, config, bit `measuring` con la duración de la
+ * conversión según el sobremuestreo, modos sleep/forced/normal con t_sb, filtro IIR, NVM de
+ * calibración y registros de datos generados a partir de una forma de onda de temperatura y
+ * presión (invirtiendo la compensación de la hoja de datos).
+ *
+ * El simulador lleva un reloj virtual en microsegundos que avanza con cada transacción SPI
+ * (bytes * 8 / f_SCK más un costo fijo por ventana de CS) o I2C (9 ciclos de SCL por byte) y
+ * con ::BMP280_Sim_Advance_Us, y cuenta transacciones, bytes y tiempo de bus, de modo que se
+ * puede comparar la eficiencia de bus de distintas versiones del driver sin hardware.
+ */
+
+#ifndef BMP280_INC_BMP280_SIM_H_
+#define BMP280_INC_BMP280_SIM_H_
+
+#include <stdint.h>
+
+#define BMP280_SIM_SPI_HZ_DEFAULT		1312500u	/**< 42 MHz (APB1) / 32, como BMP280_Port_Init */
+#define BMP280_SIM_CS_OVERHEAD_NS		2000u		/**< Costo fijo por transacción (CS, HAL) */
+#define BMP280_SIM_STARTUP_US			2000u		/**< Copia de la NVM tras CHIP_RESET (t_startup) */
+#define BMP280_SIM_I2C_HZ				100000u		/**< SCL del bus I2C simulado */
+#define BMP280_SIM_I2C_ADDR_LOW			0x76u		/**< Direcciones I2C a las que responde el sensor */
+#define BMP280_SIM_I2C_ADDR_HIGH		0x77u
+
+/**
+ * @brief Forma de onda que alimenta al simulador.
+ *
+ * @param timeUs      Instante del fin de la conversión, en µs del reloj virtual.
+ * @param temperature Temperatura a simular en grados Celsius.
+ * @param pressure    Presión a simular en Pascales.
+ */
+typedef void (*bmp280_sim_waveform_t)(uint64_t timeUs, double *temperature, double *pressure);
+
+/**
+ * @brief Contadores de bus del simulador.
+ */
+typedef struct
+{
+	uint32_t transactions;         /**< Ventanas de CS */
+	uint32_t bytes;                /**< Bytes transferidos en total */
+	uint64_t busTimeNs;            /**< Tiempo de bus modelado */
+	uint32_t conversions;          /**< Conversiones completadas por el sensor simulado */
+} bmp280_sim_stats_t;
+
+/**
+ * @brief Vuelve el sensor simulado al estado de encendido y pone a cero el reloj y los contadores.
+ *
+ * Conserva la forma de onda, la calibración y la frecuencia de SCK configuradas.
+ */
+void BMP280_Sim_Reset(void);
+
+/**
+ * @brief Reemplaza la forma de onda (NULL: 25 °C y 100000 Pa constantes).
+ *
+ * @param waveform Función a evaluar al final de cada conversión.
+ */
+void BMP280_Sim_Set_Waveform(bmp280_sim_waveform_t waveform);
+
+/**
+ * @brief Reemplaza el bloque de calibración (por defecto, el ejemplo de la hoja de datos).
+ *
+ * @param nvm Registros 0x88 ... 0x9F (24 bytes).
+ */
+void BMP280_Sim_Set_Calibration(const uint8_t *nvm);
+
+/**
+ * @brief Fija la frecuencia de SCK de la velocidad 0 del puerto; cada velocidad siguiente la duplica.
+ *
+ * @param hz Frecuencia en Hz.
+ */
+void BMP280_Sim_Set_Spi_Clock(uint32_t hz);
+
+/**
+ * @brief Hace fallar las próximas transacciones (el puerto devuelve BMP280_PORT_ERROR).
+ *
+ * Sirve para ejercitar la recuperación del driver ante fallas transitorias del bus.
+ *
+ * @param count Cantidad de transacciones a hacer fallar.
+ */
+void BMP280_Sim_Fail_Next(uint32_t count);
+
+/**
+ * @brief Simula un bus que no tolera frecuencias altas (cableado largo, capacidad parásita).
+ *
+ * Por encima de `hz`, los bytes leídos llegan corridos un bit, como si MISO se muestreara tarde.
+ *
+ * @param hz Frecuencia máxima confiable en Hz (0: sin límite, valor por defecto).
+ */
+void BMP280_Sim_Set_Max_Reliable_Hz(uint32_t hz);
+
+/**
+ * @brief Avanza el reloj virtual (equivalente a que el micro espere o haga otra cosa).
+ *
+ * @param us Microsegundos a avanzar.
+ */
+void BMP280_Sim_Advance_Us(uint32_t us);
+
+/**
+ * @brief Devuelve el reloj virtual.
+ *
+ * @return Microsegundos desde ::BMP280_Sim_Reset.
+ */
+uint64_t BMP280_Sim_Get_Time_Us(void);
+
+/**
+ * @brief Copia los contadores de bus.
+ *
+ * @param out Estructura destino.
+ */
+void BMP280_Sim_Get_Stats(bmp280_sim_stats_t *out);
+
+#endif /* BMP280_INC_BMP280_SIM_H_ */
@@ -11,63 +11,213 @@
  */
 
 #include "BMP280.h"
+#include "BMP280_cache.h"
 #include "API_swo.h"
 
-/* Estructura privada para almacenar las constantes de calibración internas del BMP280 */
-typedef struct {
-    uint16_t dig_T1;
-    int16_t  dig_T2;
-    int16_t  dig_T3;
-    uint16_t dig_P1;
-    int16_t  dig_P2;
-    int16_t  dig_P3;
-    int16_t  dig_P4;
-    int16_t  dig_P5;
-    int16_t  dig_P6;
-    int16_t  dig_P7;
-    int16_t  dig_P8;
-    int16_t  dig_P9;
-} bmp280_calib_data_t;
-
-static bmp280_calib_data_t calib;
+
+/* Bits de bmp280_t.dirty: registros con un valor pedido que aún no se escribió */
+#define SHADOW_CTRL_MEAS		((uint8_t) 0x01)
+#define SHADOW_CONFIG			((uint8_t) 0x02)
+
+/* Dispositivos inicializados, indexados por chip select, para despachar los callbacks del DMA */
+static bmp280_t *devices[BMP280_DEVICE_COUNT];
+
+/* Configuración por defecto: x1/x1, sin filtro, disparo en modo forced */
+static const bmp280_config_t defaultConfig = {
+	.osrsT = TEMP_OVER_x1, .osrsP = PRESS_OVER_x1, .filter = FILTER_COEFF_OFF,
+	.standby = STANDBY_05, .mode = FORCED_MODE
+};
+
+/* Perfiles recomendados por la hoja de datos (sección 3.8.2, tabla 15), indexados por bmp280_profile_t */
+static const bmp280_config_t profileTable[BMP280_PROFILE_COUNT] = {
+	[BMP280_PROFILE_HANDHELD_LOW_POWER] = { TEMP_OVER_x2, PRESS_OVER_x16, FILTER_COEFF_X4,  STANDBY_625, NORMAL_MODE },
+	[BMP280_PROFILE_HANDHELD_DYNAMIC]   = { TEMP_OVER_x1, PRESS_OVER_x4,  FILTER_COEFF_X16, STANDBY_05,  NORMAL_MODE },
+	[BMP280_PROFILE_WEATHER_MONITORING] = { TEMP_OVER_x1, PRESS_OVER_x1,  FILTER_COEFF_OFF, STANDBY_05,  FORCED_MODE },
+	[BMP280_PROFILE_ELEVATOR]           = { TEMP_OVER_x1, PRESS_OVER_x4,  FILTER_COEFF_X4,  STANDBY_125, NORMAL_MODE },
+	[BMP280_PROFILE_DROP_DETECTION]     = { TEMP_OVER_x1, PRESS_OVER_x2,  FILTER_COEFF_OFF, STANDBY_05,  NORMAL_MODE },
+	[BMP280_PROFILE_INDOOR_NAVIGATION]  = { TEMP_OVER_x2, PRESS_OVER_x16, FILTER_COEFF_X16, STANDBY_05,  NORMAL_MODE },
+};
+
+/* Tiempos máximos de medición de la hoja de datos (sección 9.1, apéndice B) en microsegundos */
+#define MEAS_TIME_BASE_US		1250	/* Arranque de la conversión */
+#define MEAS_TIME_PER_OSRS_US	2300	/* Por cada sobremuestreo de temperatura o presión */
+#define MEAS_TIME_PRESS_US		575		/* Adicional si se mide presión */
+
+/* Cantidad de sobremuestreos indexada por el campo osrs (000 = skip, 101..111 = x16) */
+static const uint8_t osrsTable[8] = { 0, 1, 2, 4, 8, 16, 16, 16 };
+
+/* Duración de cada t_sb en microsegundos, indexada por el campo t_sb (config[7:5]) */
+static const uint32_t standbyTableUs[8] = {
+	500, 62500, 125000, 250000, 500000, 1000000, 2000000, 4000000
+};
+
+/**
+ * @brief Precalcula los coeficientes escalados de la compensación en simple precisión.
+ *
+ * Se ejecuta una sola vez por lectura de calibración, por lo que las divisiones
+ * quedan fuera del camino por muestra.
+ *
+ * @param cal  Coeficientes de calibración del sensor.
+ * @param calF Coeficientes escalados resultantes.
+ */
+static void BMP280_Precompute_Float(const bmp280_calib_data_t *cal, bmp280_calib_float_t *calF)
+{
+	calF->t1  = (float)cal->dig_T1 / 8192.0f;
+	calF->t2  = (float)cal->dig_T2 / 16384.0f;
+	calF->t12 = (float)cal->dig_T1 * (float)cal->dig_T2 / 1024.0f;
+	calF->t3  = (float)cal->dig_T3;
+
+	calF->p1  = (float)cal->dig_P1;
+	calF->invP1x6250 = (cal->dig_P1 != 0) ? 6250.0f / (float)cal->dig_P1 : 0.0f;
+	calF->p2  = (float)cal->dig_P2 / 524288.0f;
+	calF->p3  = (float)cal->dig_P3 / 524288.0f / 524288.0f;
+	calF->p4  = (float)cal->dig_P4 * 65536.0f;
+	calF->p5  = (float)cal->dig_P5 * 2.0f;
+	calF->p6  = (float)cal->dig_P6 / 32768.0f;
+	calF->p7  = (float)cal->dig_P7 / 16.0f;
+	calF->p8  = (float)cal->dig_P8 / 32768.0f;
+	calF->p9  = (float)cal->dig_P9 / 2147483648.0f;
+}
 
 /**
- * @brief Lee los coeficientes de calibración desde los registros del BMP280.
+ * @brief Registra un error de comunicación y, si se repite, baja la velocidad de SCK.
+ *
+ * Tras BMP280_CLOCK_FALLBACK_ERRORS errores sin una muestra válida de por medio, se vuelve a
+ * la velocidad anterior a la negociada por ::BMP280_Negotiate_Clock.
+ *
+ * @param dev Dispositivo en el que ocurrió el error.
+ */
+static void BMP280_Comm_Error(bmp280_t *dev)
+{
+	if(++dev->commErrors >= BMP280_CLOCK_FALLBACK_ERRORS)
+	{
+		dev->commErrors = 0;
+		if(dev->speed > 0 && dev->bus->setSpeed(dev->cs, dev->speed - 1) == BMP280_PORT_OK)
+		{
+			dev->speed--;
+			dev->stats.clockFallbacks++;
+		}
+	}
+}
+
+/**
+ * @brief Lee una secuencia de registros contiguos en una única transferencia.
+ *
+ * El sensor autoincrementa la dirección, por lo que el bloque sale en una sola transacción
+ * del bus del dispositivo, sea SPI o I2C.
+ *
+ * @param dev  Dispositivo a leer.
+ * @param reg  Dirección del primer registro.
+ * @param data Buffer destino de `size` bytes.
+ * @param size Cantidad de registros a leer (como máximo BMP280_BURST_MAX).
+ * @return BMP280_OK si fue exitoso, BMP280_BUSY si el bus lo tiene otro dispositivo,
+ *         BMP280_ERROR_COMM si no.
+ */
+static bmp280_status_t BMP280_Read_Registers(bmp280_t *dev, uint8_t reg, uint8_t *data, uint8_t size)
+{
+	bmp280_port_status_t status;
+
+	if(size == 0 || size > BMP280_BURST_MAX)
+		return BMP280_ERROR_PARAM;
+
+	/* Primer nivel de recuperación: una transferencia con error se repite en el acto */
+	for(uint8_t attempt = 0; ; attempt++)
+	{
+		dev->stats.transactions++;
+		status = dev->bus->read(dev->cs, reg, data, size);
+		if(status == BMP280_PORT_OK)
+			return BMP280_OK;
+		if(status == BMP280_PORT_BUSY)
+			return BMP280_BUSY;			/* Otro dispositivo tiene el bus: no es un error del sensor */
+		if(attempt >= BMP280_RETRY_COUNT)
+			break;
+		dev->stats.retries++;
+	}
+
+	BMP280_Comm_Error(dev);
+	return BMP280_ERROR_COMM;
+}
+
+/**
+ * @brief Arma los coeficientes de calibración a partir del bloque crudo de registros.
+ *
+ * @param dev Dispositivo cuya calibración se actualiza.
+ * @param nvm Registros 0x88 ... 0x9F, leídos del sensor o de la caché.
+ */
+static void BMP280_Parse_Calibration(bmp280_t *dev, const uint8_t *nvm)
+{
+	bmp280_calib_data_t *calib = &dev->calib;
+																	/* LSB  /  MSB	*/
+	calib->dig_T1 = (uint16_t)(nvm[ 0] 	| (nvm[ 1] << 8));			/* 0x88 / 0x89	*/
+	calib->dig_T2 = (int16_t) (nvm[ 2] 	| (nvm[ 3] << 8));
+	calib->dig_T3 = (int16_t) (nvm[ 4] 	| (nvm[ 5] << 8));
+	calib->dig_P1 = (uint16_t)(nvm[ 6] 	| (nvm[ 7] << 8));
+	calib->dig_P2 = (int16_t) (nvm[ 8] 	| (nvm[ 9] << 8));
+	calib->dig_P3 = (int16_t) (nvm[10]	| (nvm[11] << 8));
+	calib->dig_P4 = (int16_t) (nvm[12] 	| (nvm[13] << 8));
+	calib->dig_P5 = (int16_t) (nvm[14] 	| (nvm[15] << 8));
+	calib->dig_P6 = (int16_t) (nvm[16] 	| (nvm[17] << 8));
+	calib->dig_P7 = (int16_t) (nvm[18] 	| (nvm[19] << 8));
+	calib->dig_P8 = (int16_t) (nvm[20] 	| (nvm[21] << 8));
+	calib->dig_P9 = (int16_t) (nvm[22] 	| (nvm[23] << 8));			/* 0x9E / 0x9F	*/
+
+	BMP280_Precompute_Float(&dev->calib, &dev->calibF);
+}
+
+/**
+ * @brief Obtiene los coeficientes de calibración del BMP280.
  *
  * Los coeficientes de calibración están almacenados en registros contiguos entre 0x88 y 0x9F.
- * Se realiza una lectura por ráfaga de 24 bytes + 1 byte de dirección (25 en total),
- * optimizando así la comunicación SPI.
+ * Si la caché persistente tiene una entrada válida para este chip select e ID se usa esa;
+ * si no, se realiza una lectura por ráfaga de 24 bytes + 1 byte de dirección (25 en total)
+ * y el resultado se guarda en la caché para el próximo arranque.
  *
+ * @param dev      Dispositivo cuya calibración se lee.
+ * @param chipId   ID leído del sensor, parte de la clave de la caché.
+ * @param useCache false para ignorar la caché y leer siempre del sensor.
  * @return BMP280_OK si se leyeron correctamente, BMP280_ERROR_COMM si hubo un error de comunicación.
  */
-static bmp280_status_t BMP280_Get_Calibration(void)
+static bmp280_status_t BMP280_Get_Calibration(bmp280_t *dev, uint8_t chipId, bool useCache)
 {
-	uint8_t txBuffer[25];
-	uint8_t rxBuffer[25];
+	uint8_t nvm[BMP280_CALIB_SIZE];
 
-	txBuffer[0] = REG_CALIB_START | READ_MASK;
-	for(uint8_t i = 1; i < 25; i++)
-		txBuffer[i] = 0x00;
+	if(useCache && BMP280_Cache_Load(dev->cs, chipId, nvm))
+	{
+		BMP280_Parse_Calibration(dev, nvm);
+		return BMP280_OK;
+	}
 
-	if(BMP280_Transfer(txBuffer, rxBuffer, 25) != BMP280_PORT_OK)
+	if(BMP280_Read_Registers(dev, REG_CALIB_START, nvm, BMP280_CALIB_SIZE) != BMP280_OK)
 		return BMP280_ERROR_COMM;
-																			/* LSB  /  MSB	*/
-	calib.dig_T1 = (uint16_t)(rxBuffer[ 1] 	| (rxBuffer[ 2] << 8));			/* 0x88 / 0x89	*/
-	calib.dig_T2 = (int16_t) (rxBuffer[ 3] 	| (rxBuffer [4] << 8));
-	calib.dig_T3 = (int16_t) (rxBuffer[ 5] 	| (rxBuffer[ 6] << 8));
-	calib.dig_P1 = (uint16_t)(rxBuffer[ 7] 	| (rxBuffer[ 8] << 8));
-	calib.dig_P2 = (int16_t) (rxBuffer[ 9] 	| (rxBuffer[10] << 8));
-	calib.dig_P3 = (int16_t) (rxBuffer[11]	| (rxBuffer[12] << 8));
-	calib.dig_P4 = (int16_t) (rxBuffer[13] 	| (rxBuffer[14] << 8));
-	calib.dig_P5 = (int16_t) (rxBuffer[15] 	| (rxBuffer[16] << 8));
-	calib.dig_P6 = (int16_t) (rxBuffer[17] 	| (rxBuffer[18] << 8));
-	calib.dig_P7 = (int16_t) (rxBuffer[19] 	| (rxBuffer[20] << 8));
-	calib.dig_P8 = (int16_t) (rxBuffer[21] 	| (rxBuffer[22] << 8));
-	calib.dig_P9 = (int16_t) (rxBuffer[23] 	| (rxBuffer[24] << 8));			/* 0x9E / 0x9F	*/
+
+	BMP280_Parse_Calibration(dev, nvm);
+
+	/* Una falla de la caché no impide usar el sensor: el próximo arranque vuelve a leer */
+	BMP280_Cache_Store(dev->cs, chipId, nvm);
 
 	return BMP280_OK;
 }
 
+/**
+ * @brief Arma los valores crudos de 20 bits a partir de la ráfaga de datos.
+ *
+ * @param data Seis bytes leídos desde REG_PRESS_MSB (press_msb ... temp_xlsb).
+ * @param rawTemp Puntero donde se almacenará la temperatura cruda (20 bits).
+ * @param rawPress Puntero donde se almacenará la presión cruda (20 bits).
+ */
+static void BMP280_Decode_Raw(const uint8_t *data, uint32_t *rawTemp, uint32_t *rawPress)
+{
+	// Presión: 20 bits (MSB << 12) | (LSB << 4) | (XLSB >> 4)
+	*rawPress =	((int32_t)data[0] << 12) |
+	            ((int32_t)data[1] << 4)  |
+	            ((int32_t)data[2] >> 4);
+
+	// Temperatura: 20 bits (MSB << 12) | (LSB << 4) | (XLSB >> 4)
+	*rawTemp = 	((int32_t)data[3] << 12) |
+	            ((int32_t)data[4] << 4)  |
+	            ((int32_t)data[5] >> 4);
+}
+
 /**
  * @brief Lee los valores crudos de temperatura y presión desde los registros del sensor.
  *
@@ -75,150 +225,508 @@ static bmp280_status_t BMP280_Get_Calibration(void)
  * comenzando desde REG_PRESS_MSB. El BMP280 recomienda esta lectura continua para garantizar
  * la coherencia entre ambos parámetros.
  *
- * @param dev Puntero al descriptor del dispositivo BMP280.
- * @param rawTemp Puntero donde se almacenará la temperatura cruda (20 bits).
- * @param rawPress Puntero donde se almacenará la presión cruda (20 bits).
+ * @param dev  Puntero al descriptor del dispositivo BMP280.
+ * @param data Destino de los BMP280_DATA_SIZE bytes crudos (press_msb ... temp_xlsb).
  * @return BMP280_OK si fue exitoso, o un código de error en caso contrario.
  */
-static bmp280_status_t BMP280_Read_Raw_Parameters(bmp280_t *dev, uint32_t *rawTemp, uint32_t *rawPress)
+static bmp280_status_t BMP280_Read_Raw_Parameters(bmp280_t *dev, uint8_t *data)
 {
 	if (dev == NULL) return BMP280_ERROR_PARAM;
 
-	uint8_t txBuffer[7];
-	uint8_t rxBuffer[7];
-
-	txBuffer[0] = REG_PRESS_MSB | READ_MASK;
-	for(uint8_t i = 1; i < 7; i++)
-		txBuffer[i] = 0x00;
-
-	if(BMP280_Transfer(txBuffer, rxBuffer, 7) != BMP280_PORT_OK)
+	if(BMP280_Read_Registers(dev, REG_PRESS_MSB, data, BMP280_DATA_SIZE) != BMP280_OK)
 		return BMP280_ERROR_COMM;
 
-	// Presión: 20 bits (MSB << 12) | (LSB << 4) | (XLSB >> 4)
-	*rawPress =	((int32_t)rxBuffer[1] << 12) |
-	            ((int32_t)rxBuffer[2] << 4)  |
-	            ((int32_t)rxBuffer[3] >> 4);
-
-	// Temperatura: 20 bits (MSB << 12) | (LSB << 4) | (XLSB >> 4)
-	*rawTemp = 	((int32_t)rxBuffer[4] << 12) |
-	            ((int32_t)rxBuffer[5] << 4)  |
-	            ((int32_t)rxBuffer[6] >> 4);
-
 	return BMP280_OK;
 
 }
 
 /**
- * @brief Compensa los valores de temperatura y presión crudos del sensor BMP280.
+ * @brief Compensa los valores crudos utilizando la fórmula en punto flotante.
  *
  * Esta función aplica las fórmulas de compensación definidas en la hoja de datos del BMP280
  * para convertir los valores crudos de temperatura y presión en valores reales en unidades
  * físicas. Los resultados se almacenan en el struct del dispositivo.
  *
+ * @param cal      Coeficientes de calibración a utilizar.
  * @param dev      Puntero a la estructura `bmp280_t` que contiene los valores compensados.
- * @param rawTemp      Valor crudo de temperatura leído del sensor.
- * @param rawPress     Valor crudo de presión leído del sensor.
+ * @param rawTemp  Valor crudo de temperatura leído del sensor.
+ * @param rawPress Valor crudo de presión leído del sensor.
  *
  * @return bmp280_status_t Devuelve `BMP280_OK` si la compensación fue exitosa, o `BMP280_ERROR_NAN`
  *                         si ocurrió una división por cero durante la compensación de presión.
- *
- * @note Esta función utiliza coeficientes de calibración globales almacenados en `calib`.
- *       Se recomienda asegurarse de que dichos coeficientes hayan sido leídos correctamente
- *       desde el sensor antes de ejecutar esta función.
- *
- * @warning Esta función imprime por consola los valores de temperatura y presión compensados.
- *          En sistemas embebidos sin salida estándar, esta funcionalidad debe desactivarse o redirigirse.
  */
-static bmp280_status_t BMP280_Compensate_Values(bmp280_t *dev, uint32_t rawTemp, uint32_t rawPress)
+static bmp280_status_t BMP280_Compensate_Float(const bmp280_calib_data_t *cal, bmp280_t *dev, uint32_t rawTemp, uint32_t rawPress)
 {
 	float var1, var2, t_fine;
 	/* Compensación de tempertaura */
 
-	var1 = (((float)rawTemp) / 16384.0 - ((float)calib.dig_T1) / 1024.0) * ((float)calib.dig_T2);
-	var2 = ((((float)rawTemp) / 131072.0 - ((float)calib.dig_T1) / 8192.0) *
-	        (((float)rawTemp) / 131072.0 - ((float)calib.dig_T1) / 8192.0)) * ((float)calib.dig_T3);
+	var1 = (((float)rawTemp) / 16384.0 - ((float)cal->dig_T1) / 1024.0) * ((float)cal->dig_T2);
+	var2 = ((((float)rawTemp) / 131072.0 - ((float)cal->dig_T1) / 8192.0) *
+	        (((float)rawTemp) / 131072.0 - ((float)cal->dig_T1) / 8192.0)) * ((float)cal->dig_T3);
 
 	t_fine = (int32_t)(var1 + var2);
 	dev->temperature = (var1 + var2) / 5120.0;
 
-	printf("Temperature: %0.1f C\r\n",dev->temperature);
-
 	/* Compensación de presión */
 
     var1 = ((float)t_fine / 2.0) - 64000.0;
-    var2 = var1 * var1 * ((float)calib.dig_P6) / 32768.0;
-    var2 = var2 + var1 * ((float)calib.dig_P5) * 2.0;
-    var2 = (var2 / 4.0) + (((float)calib.dig_P4) * 65536.0);
-    var1 = (((float)calib.dig_P3) * var1 * var1 / 524288.0 +
-            ((float)calib.dig_P2) * var1) / 524288.0;
-    var1 = (1.0 + var1 / 32768.0) * ((float)calib.dig_P1);
+    var2 = var1 * var1 * ((float)cal->dig_P6) / 32768.0;
+    var2 = var2 + var1 * ((float)cal->dig_P5) * 2.0;
+    var2 = (var2 / 4.0) + (((float)cal->dig_P4) * 65536.0);
+    var1 = (((float)cal->dig_P3) * var1 * var1 / 524288.0 +
+            ((float)cal->dig_P2) * var1) / 524288.0;
+    var1 = (1.0 + var1 / 32768.0) * ((float)cal->dig_P1);
 
     if (var1 == 0.0) return BMP280_ERROR_NAN;
 
     dev->pressure = 1048576.0 - (float)rawPress;
     dev->pressure = (dev->pressure - (var2 / 4096.0)) * 6250.0 / var1;
-    var1 = ((float)calib.dig_P9) * dev->pressure * dev->pressure / 2147483648.0;
-    var2 = dev->pressure * ((float)calib.dig_P8) / 32768.0;
-    dev->pressure = dev->pressure + (var1 + var2 + ((float)calib.dig_P7)) / 16.0;
+    var1 = ((float)cal->dig_P9) * dev->pressure * dev->pressure / 2147483648.0;
+    var2 = dev->pressure * ((float)cal->dig_P8) / 32768.0;
+    dev->pressure = dev->pressure + (var1 + var2 + ((float)cal->dig_P7)) / 16.0;
     dev->pressure /= 100.0;
 
-    printf("Pressure: %0.1f hPa\r\n",dev->pressure);
-
     return BMP280_OK;
 }
 
 /**
- * @brief Inicializa el sensor BMP280.
+ * @brief Compensa los valores crudos utilizando la aritmética entera de referencia de Bosch.
+ *
+ * La temperatura se calcula con enteros de 32 bits y devuelve centésimas de grado
+ * (5123 equivale a 51,23 °C). La presión se calcula con enteros de 64 bits y devuelve
+ * Pa en formato Q24.8 (24674867 equivale a 24674867/256 = 96386,2 Pa). Ninguna operación
+ * pasa por la FPU ni por la emulación de doble precisión; sólo la conversión final a los
+ * campos flotantes de `bmp280_t` usa multiplicaciones en simple precisión.
+ *
+ * @param cal      Coeficientes de calibración a utilizar.
+ * @param dev      Puntero a la estructura `bmp280_t` que contiene los valores compensados.
+ * @param rawTemp  Valor crudo de temperatura leído del sensor.
+ * @param rawPress Valor crudo de presión leído del sensor.
+ *
+ * @return `BMP280_OK`, o `BMP280_ERROR_NAN` si el divisor de la compensación de presión es cero.
+ *
+ * @see BMP280 datasheet, sección 8.2 "Compensation formula in 32 bit fixed point".
+ */
+static bmp280_status_t BMP280_Compensate_Int(const bmp280_calib_data_t *cal, bmp280_t *dev, uint32_t rawTemp, uint32_t rawPress)
+{
+	int32_t adc_T = (int32_t)rawTemp;
+	int32_t adc_P = (int32_t)rawPress;
+	int32_t var1, var2, t_fine;
+	int64_t pvar1, pvar2, p;
+
+	/* Compensación de temperatura (32 bits) */
+	var1 = ((((adc_T >> 3) - ((int32_t)cal->dig_T1 << 1))) * ((int32_t)cal->dig_T2)) >> 11;
+	var2 = (((((adc_T >> 4) - ((int32_t)cal->dig_T1)) * ((adc_T >> 4) - ((int32_t)cal->dig_T1))) >> 12) *
+	        ((int32_t)cal->dig_T3)) >> 14;
+
+	t_fine = var1 + var2;
+	dev->temperatureInt = (t_fine * 5 + 128) >> 8;
+
+	/* Compensación de presión (64 bits) */
+	pvar1 = ((int64_t)t_fine) - 128000;
+	pvar2 = pvar1 * pvar1 * (int64_t)cal->dig_P6;
+	pvar2 = pvar2 + ((pvar1 * (int64_t)cal->dig_P5) << 17);
+	pvar2 = pvar2 + (((int64_t)cal->dig_P4) << 35);
+	pvar1 = ((pvar1 * pvar1 * (int64_t)cal->dig_P3) >> 8) + ((pvar1 * (int64_t)cal->dig_P2) << 12);
+	pvar1 = (((((int64_t)1) << 47) + pvar1)) * ((int64_t)cal->dig_P1) >> 33;
+
+	if (pvar1 == 0) return BMP280_ERROR_NAN;
+
+	p = 1048576 - adc_P;
+	p = (((p << 31) - pvar2) * 3125) / pvar1;
+	pvar1 = (((int64_t)cal->dig_P9) * (p >> 13) * (p >> 13)) >> 25;
+	pvar2 = (((int64_t)cal->dig_P8) * p) >> 19;
+	p = ((p + pvar1 + pvar2) >> 8) + (((int64_t)cal->dig_P7) << 4);
+
+	dev->pressureInt = (uint32_t)p;
+
+	/* Valores flotantes en las mismas unidades que el camino flotante (°C y hPa) */
+	dev->temperature = (float)dev->temperatureInt * 0.01f;
+	dev->pressure    = (float)dev->pressureInt * (1.0f / 25600.0f);
+
+	return BMP280_OK;
+}
+
+/**
+ * @brief Núcleo de la compensación en simple precisión, compartido por la versión escalar y la por lotes.
+ *
+ * No tiene saltos ni llamadas, por lo que al expandirse dentro de un lazo el compilador
+ * puede vectorizarlo.
+ *
+ * @param calF        Coeficientes escalados.
+ * @param rawTemp     Valor crudo de temperatura.
+ * @param rawPress    Valor crudo de presión.
+ * @param temperature Temperatura compensada en grados Celsius.
+ * @param pressure    Presión compensada en hectopascales.
+ * @return El divisor `dig_P1 * (1 + u)`; si es cero, la presión no es válida.
+ */
+static inline float BMP280_Compensate_SP_Core(const bmp280_calib_float_t *calF, uint32_t rawTemp, uint32_t rawPress,
+                                              float *temperature, float *pressure)
+{
+	float adcT = (float)rawTemp;
+	float var1, var2, diff, t_fine, u, inv, press;
+
+	/* Compensación de temperatura */
+	var1 = adcT * calF->t2 - calF->t12;
+	diff = adcT * (1.0f / 131072.0f) - calF->t1;
+	var2 = diff * diff * calF->t3;
+
+	t_fine = (float)(int32_t)(var1 + var2);
+	*temperature = (var1 + var2) * (1.0f / 5120.0f);
+
+	/* Compensación de presión */
+	var1 = t_fine * 0.5f - 64000.0f;
+	var2 = var1 * var1 * calF->p6 + var1 * calF->p5;
+	var2 = var2 * 0.25f + calF->p4;
+	u    = (var1 * var1 * calF->p3 + var1 * calF->p2) * (1.0f / 32768.0f);
+
+	/* 1 / (1 + u) por Newton-Raphson: inv <- inv * (2 - (1 + u) * inv) */
+	inv = 1.0f - u;
+	inv = inv * (2.0f - (1.0f + u) * inv);
+	inv = inv * (2.0f - (1.0f + u) * inv);
+
+	press = 1048576.0f - (float)rawPress;
+	press = (press - var2 * (1.0f / 4096.0f)) * calF->invP1x6250 * inv;
+	var1  = press * press * calF->p9;
+	var2  = press * calF->p8;
+	press = press + (var1 + var2) * 0.0625f + calF->p7;
+	*pressure = press * 0.01f;
+
+	return calF->p1 * (1.0f + u);
+}
+
+/**
+ * @brief Compensa los valores crudos en simple precisión y sin divisiones.
+ *
+ * Es la misma fórmula flotante de la hoja de datos, reordenada para que ninguna
+ * operación promueva a `double` y para que los cocientes por constantes sean productos
+ * por los coeficientes de `bmp280_calib_float_t`.
+ *
+ * El único divisor que depende de la muestra es `dig_P1 * (1 + u)`, con |u| < 0,1 en
+ * todo el rango de operación. Su inversa se obtiene partiendo de `1 - u` (error u^2)
+ * y aplicando dos iteraciones de Newton-Raphson, que dejan un error relativo del orden
+ * de u^8, por debajo de la resolución de un `float`.
+ *
+ * @param calF     Coeficientes escalados.
+ * @param dev      Puntero a la estructura `bmp280_t` que contiene los valores compensados.
+ * @param rawTemp  Valor crudo de temperatura leído del sensor.
+ * @param rawPress Valor crudo de presión leído del sensor.
+ *
+ * @return `BMP280_OK`, o `BMP280_ERROR_NAN` si el divisor de la compensación de presión es cero.
+ */
+static bmp280_status_t BMP280_Compensate_Float_SP(const bmp280_calib_float_t *calF, bmp280_t *dev, uint32_t rawTemp, uint32_t rawPress)
+{
+	if (BMP280_Compensate_SP_Core(calF, rawTemp, rawPress, &dev->temperature, &dev->pressure) == 0.0f)
+		return BMP280_ERROR_NAN;
+
+	return BMP280_OK;
+}
+
+/**
+ * @brief Compensa los valores de temperatura y presión crudos del sensor BMP280.
+ *
+ * Delega en el algoritmo seleccionado con ::BMP280_Set_Compensation.
+ *
+ * @param dev      Puntero a la estructura `bmp280_t` que contiene los valores compensados.
+ * @param rawTemp  Valor crudo de temperatura leído del sensor.
+ * @param rawPress Valor crudo de presión leído del sensor.
+ *
+ * @return bmp280_status_t Devuelve `BMP280_OK` si la compensación fue exitosa, o `BMP280_ERROR_NAN`
+ *                         si ocurrió una división por cero durante la compensación de presión.
+ *
+ * @note Esta función utiliza los coeficientes de calibración del propio dispositivo.
+ *       Se recomienda asegurarse de que dichos coeficientes hayan sido leídos correctamente
+ *       desde el sensor antes de ejecutar esta función.
+ */
+static bmp280_status_t BMP280_Compensate_Values(bmp280_t *dev, uint32_t rawTemp, uint32_t rawPress)
+{
+	if(dev->comp == BMP280_COMP_INT)
+		return BMP280_Compensate_Int(&dev->calib, dev, rawTemp, rawPress);
+
+	if(dev->comp == BMP280_COMP_FLOAT_SP)
+		return BMP280_Compensate_Float_SP(&dev->calibF, dev, rawTemp, rawPress);
+
+	return BMP280_Compensate_Float(&dev->calib, dev, rawTemp, rawPress);
+}
+
+/**
+ * @brief Escribe pares registro/valor en una única transacción.
+ *
+ * La hoja de datos (sección 5.3.2) permite encadenar varios pares dentro de la misma
+ * ventana de CS; por I2C, se encadenan en la misma trama (sección 5.2.1).
+ *
+ * @param dev   Dispositivo destino.
+ * @param pairs Pares registro/valor.
+ * @param size  Cantidad de bytes (par).
+ * @return BMP280_OK si fue exitoso, BMP280_BUSY si el bus lo tiene otro dispositivo,
+ *         BMP280_ERROR_COMM si no.
+ */
+static bmp280_status_t BMP280_Write_Pairs(bmp280_t *dev, const uint8_t *pairs, uint8_t size)
+{
+	bmp280_port_status_t status;
+
+	for(uint8_t attempt = 0; ; attempt++)
+	{
+		dev->stats.transactions++;
+		status = dev->bus->write(dev->cs, pairs, size);
+		if(status == BMP280_PORT_OK)
+		{
+			dev->stats.registerWrites += size / 2;
+			return BMP280_OK;
+		}
+		if(status == BMP280_PORT_BUSY)
+			return BMP280_BUSY;
+		if(attempt >= BMP280_RETRY_COUNT)
+			break;
+		dev->stats.retries++;
+	}
+
+	BMP280_Comm_Error(dev);
+	return BMP280_ERROR_COMM;
+}
+
+/**
+ * @brief Escribe un registro del BMP280.
+ *
+ * @param dev   Dispositivo destino.
+ * @param reg   Dirección del registro.
+ * @param value Valor a escribir.
+ * @return BMP280_OK si fue exitoso, BMP280_ERROR_COMM si no.
+ */
+static bmp280_status_t BMP280_Write_Register(bmp280_t *dev, uint8_t reg, uint8_t value)
+{
+	const uint8_t pair[2] = { reg, value };
+
+	return BMP280_Write_Pairs(dev, pair, 2);
+}
+
+/**
+ * @brief Vuelca al sensor los registros pendientes en una sola transacción.
+ *
+ * `config` (t_sb y filtro) sólo se escribe de forma confiable en SLEEP, por lo que si el
+ * sensor está en NORMAL_MODE y ese registro cambia, la transacción empieza pasándolo a
+ * SLEEP y termina con `ctrl_meas`. Si no hay nada pendiente ni disparo, no hay transacción.
+ *
+ * @param dev  Dispositivo destino.
+ * @param mode FORCED_MODE para disparar una medición con el mismo `ctrl_meas`, o SLEEP_MODE.
+ * @return BMP280_OK, BMP280_BUSY (nada se escribió; reintentar) o BMP280_ERROR_COMM.
+ */
+static bmp280_status_t BMP280_Flush_Registers(bmp280_t *dev, uint8_t mode)
+{
+	bmp280_status_t status;
+	uint8_t pairs[6];
+	uint8_t size = 0;
+	bool writeCtrlMeas = (dev->dirty & SHADOW_CTRL_MEAS) || mode != SLEEP_MODE;
+
+	if(dev->dirty & SHADOW_CONFIG)
+	{
+		if((dev->regCtrlMeas & CTRL_MEAS_MODE) == NORMAL_MODE)
+		{
+			pairs[size++] = REG_CTRL_MEAS;
+			pairs[size++] = (dev->regCtrlMeas & ~CTRL_MEAS_MODE) | SLEEP_MODE;
+			writeCtrlMeas = true;
+		}
+		pairs[size++] = REG_CONFIG;
+		pairs[size++] = dev->pendConfig;
+	}
+
+	if(writeCtrlMeas)
+	{
+		pairs[size++] = REG_CTRL_MEAS;
+		pairs[size++] = dev->pendCtrlMeas | mode;
+	}
+
+	if(size == 0)
+		return BMP280_OK;
+
+	status = BMP280_Write_Pairs(dev, pairs, size);
+	if(status != BMP280_OK)
+		return (status == BMP280_BUSY) ? BMP280_BUSY : BMP280_ERROR_COMM;
+
+	/* Tras un disparo el sensor vuelve solo a SLEEP, que es lo que ya indica pendCtrlMeas */
+	dev->regConfig = dev->pendConfig;
+	dev->regCtrlMeas = dev->pendCtrlMeas;
+	dev->dirty = 0;
+
+	return BMP280_OK;
+}
+
+/**
+ * @brief Actualiza la copia de los registros según la configuración pedida y la vuelca al sensor.
+ *
+ * Sólo se marcan como pendientes los registros que difieren de lo que tiene el sensor. En
+ * modo forced el volcado se difiere al próximo ::BMP280_Trigger_Measurement, que escribe igual
+ * `ctrl_meas`; al entrar o salir de NORMAL_MODE se escribe en el acto.
+ *
+ * @param dev   Dispositivo destino.
+ * @param cfg   Configuración a aplicar.
+ * @param force Si es true se escriben ambos registros sin comparar (estado del sensor desconocido).
+ * @return BMP280_OK, BMP280_ERROR_PARAM si la configuración no es válida o BMP280_ERROR_COMM.
+ */
+static bmp280_status_t BMP280_Apply_Config(bmp280_t *dev, const bmp280_config_t *cfg, bool force)
+{
+	if(cfg == NULL || (cfg->osrsT & ~CTRL_MEAS_OSRS_T) || (cfg->osrsP & ~CTRL_MEAS_OSRS_P) ||
+	   (cfg->filter & ~CONFIG_FILTER) || (cfg->standby & ~CONFIG_T_SB) ||
+	   (cfg->mode != SLEEP_MODE && cfg->mode != FORCED_MODE && cfg->mode != NORMAL_MODE))
+		return BMP280_ERROR_PARAM;
+
+	/* En modo forced el registro queda en SLEEP; cada disparo escribe FORCED */
+	dev->pendConfig = cfg->standby | cfg->filter;
+	dev->pendCtrlMeas = cfg->osrsT | cfg->osrsP | (cfg->mode == NORMAL_MODE ? NORMAL_MODE : SLEEP_MODE);
+
+	if(force)
+	{
+		/* Puede haber quedado en NORMAL_MODE (p. ej. si sólo se reinició el micro): se pasa a SLEEP antes de config */
+		dev->regCtrlMeas = NORMAL_MODE;
+		dev->dirty = SHADOW_CTRL_MEAS | SHADOW_CONFIG;
+	}
+	else
+	{
+		dev->dirty = 0;
+		if(dev->pendConfig != dev->regConfig)
+			dev->dirty |= SHADOW_CONFIG;
+		if(dev->pendCtrlMeas != dev->regCtrlMeas)
+			dev->dirty |= SHADOW_CTRL_MEAS;
+	}
+
+	dev->config = *cfg;
+
+	if(cfg->mode == FORCED_MODE && (dev->regCtrlMeas & CTRL_MEAS_MODE) != NORMAL_MODE)
+		return BMP280_OK;
+
+	return BMP280_Flush_Registers(dev, SLEEP_MODE);
+}
+
+/**
+ * @brief Entrega la ráfaga a la captura, la decodifica, la valida, la compensa y actualiza el dispositivo.
  *
- * Se realiza un envío de paquete dummy para estabilizar la línea SCK (recomendado para SPI),
- * luego se lee el ID del sensor y se configuran los registros `config` y `ctrl_meas`.
+ * Todos los caminos de lectura (bloqueante, combinada con STATUS y por DMA) terminan aquí.
+ *
+ * @param dev  Puntero al descriptor del BMP280.
+ * @param data Los BMP280_DATA_SIZE bytes crudos (press_msb ... temp_xlsb).
+ * @return BMP280_OK si se actualizaron correctamente, o un error correspondiente.
+ */
+static bmp280_status_t BMP280_Process_Burst(bmp280_t *dev, const uint8_t *data)
+{
+	bmp280_status_t status;
+	uint32_t rawTemp, rawPress;
+	uint32_t tick = BMP280_Port_Get_Tick();
+
+	if(dev->capture != NULL)
+		dev->capture(dev->cs, tick, data);
+
+	BMP280_Decode_Raw(data, &rawTemp, &rawPress);
+
+	if(rawTemp == 0 || rawPress == 0)
+	{
+		BMP280_Comm_Error(dev);
+		return BMP280_ERROR_COMM;		/* Si los datos leídos son cero, indica un posible error en la linea MISO */
+	}
+
+	status = BMP280_Compensate_Values(dev, rawTemp, rawPress);
+	if(status != BMP280_OK)
+		return status;
+
+	dev->stats.samples++;
+	dev->commErrors = 0;
+
+	if(dev->ring != NULL)
+	{
+		bmp280_sample_t sample = {
+			.timestamp = tick,
+			.rawTemp = rawTemp, .rawPress = rawPress,
+			.temperature = dev->temperature, .pressure = dev->pressure,
+			.cs = dev->cs
+		};
+		BMP280_Ring_Push(dev->ring, &sample);
+	}
+
+#if BMP280_PRINT_SAMPLES
+	printf("Temperature: %0.1f C\r\n",dev->temperature);
+	printf("Pressure: %0.1f hPa\r\n",dev->pressure);
+#endif
+
+	return BMP280_OK;
+}
+
+/**
+ * @brief Inicializa el sensor BMP280 sobre el bus indicado.
+ *
+ * El bus prepara el periférico (en SPI, con un envío de paquete dummy para estabilizar la
+ * línea SCK), luego se lee el ID del sensor y se configuran los registros `config` y `ctrl_meas`.
  * Finalmente, se cargan los coeficientes de calibración. Es importante que la función
  * sea llamada una vez tras energizar el sensor.
  *
- * @param dev Puntero a la estructura del dispositivo a inicializar.
+ * @param dev  Puntero a la estructura del dispositivo a inicializar.
+ * @param bus  Transporte del sensor (::BMP280_Bus_SPI o ::BMP280_Bus_I2C).
+ * @param addr Chip select (SPI) o dirección de esclavo (I2C).
  * @return BMP280_OK si se inicializó correctamente, o un código de error.
  */
-bmp280_status_t BMP280_Init(void)
+bmp280_status_t BMP280_Init_Bus(bmp280_t *dev, const bmp280_bus_t *bus, uint8_t addr)
 {
-	uint8_t txBuffer[2];
-	uint8_t rxBuffer[2];
+	uint8_t id;
 
-	/* Inicializo el periférico SPI*/
-	if(BMP280_Port_Init() != BMP280_PORT_OK)
-		return BMP280_ERROR_COMM;
+	if(dev == NULL || bus == NULL || addr < bus->minAddr || addr > bus->maxAddr)
+		return BMP280_ERROR_PARAM;
+
+	/* Un descriptor que ya era de este sensor (reintento tras un error) conserva contadores,
+	 * velocidad, compensación y lo asociado por la aplicación; el resto del estado se descarta */
+	bmp280_t keep = { .comp = BMP280_COMP_FLOAT };
+	if(dev->bus == bus && dev->cs == addr)
+	{
+		keep.comp = dev->comp;
+		keep.stats = dev->stats;
+		keep.speed = dev->speed;
+		keep.ring = dev->ring;
+		keep.capture = dev->capture;
+	}
 
-	/* Envio dato dummy para estabilizar la linea SCK		*/
-	txBuffer[0] = DUMMY_PKG;
-	if(BMP280_Write(txBuffer, 1) != BMP280_PORT_OK)
+	/* Estado inicial: registros desconocidos */
+	*dev = (bmp280_t){0};
+	dev->bus = bus;
+	dev->cs = addr;
+	dev->comp = keep.comp;
+	dev->stats = keep.stats;
+	dev->ring = keep.ring;
+	dev->capture = keep.capture;
+
+	/* Sólo los buses con lectura por DMA reciben callbacks, indexados por chip select */
+	if(bus->readAsync != NULL)
+	{
+		if(addr >= BMP280_DEVICE_COUNT)
+			return BMP280_ERROR_PARAM;
+		devices[addr] = dev;
+	}
+
+	if(bus->init(addr) != BMP280_PORT_OK)
 		return BMP280_ERROR_COMM;
 
+	/* El bus arranca a la velocidad más lenta; si ya había una en uso, se la restituye */
+	if(keep.speed > 0 && keep.speed < bus->speedCount() && bus->setSpeed(addr, keep.speed) == BMP280_PORT_OK)
+		dev->speed = keep.speed;
+
 	/* Verifico leyendo id del bmp280						*/
-	txBuffer[0] = REG_ID | READ_MASK;
-	txBuffer[1] = DUMMY_PKG;
-	if(BMP280_Transfer(txBuffer, rxBuffer, 2) != BMP280_PORT_OK)
+	if(BMP280_Read_Registers(dev, REG_ID, &id, 1) != BMP280_OK)
 		return BMP280_ERROR_COMM;
 
-	if(rxBuffer[1] != CHIP_ID)
+	if(id != CHIP_ID)
 		return BMP280_ERROR_INVALID_ID;
 
-	/* Escribo configuración en el registro config			*/
-	txBuffer[0] = REG_CONFIG & WRITE_MASK;
-	txBuffer[1] = STANDBY_05 | FILTER_COEFF_OFF;
-	if(BMP280_Write(txBuffer, 2) != BMP280_PORT_OK)
+	/* Escribo la configuración por defecto en config y ctrl_meas (escritura completa) */
+	if(BMP280_Apply_Config(dev, &defaultConfig, true) != BMP280_OK)
 		return BMP280_ERROR_COMM;
 
-	/* Escribo configuración en el registro ctrl_meas		*/
-	txBuffer[0] = REG_CTRL_MEAS & WRITE_MASK;
-	txBuffer[1] = TEMP_OVER_x1 | PRESS_OVER_x1 | FORCED_MODE;
-	if(BMP280_Write(txBuffer, 2) != BMP280_PORT_OK)
-		return BMP280_ERROR_COMM;
-
-	if(BMP280_Get_Calibration() != BMP280_OK)
+	if(BMP280_Get_Calibration(dev, id, true) != BMP280_OK)
 		return BMP280_ERROR_COMM;
 
 	return BMP280_OK;
 }
 
+bmp280_status_t BMP280_Init(bmp280_t *dev, uint8_t cs)
+{
+	return BMP280_Init_Bus(dev, &BMP280_Bus_SPI, cs);
+}
+
 /**
  * @brief Dispara una medición en modo FORCED.
  *
@@ -228,17 +736,16 @@ bmp280_status_t BMP280_Init(void)
  * @param dev Puntero a la estructura del dispositivo.
  * @return BMP280_OK si el disparo fue exitoso, o un error si el modo no es FORCED.
  */
-bmp280_status_t	BMP280_Trigger_Measurement(void)
+bmp280_status_t	BMP280_Trigger_Measurement(bmp280_t *dev)
 {
-	uint8_t txBuffer[2];
+	if(dev == NULL)
+		return BMP280_ERROR_PARAM;
 
-	/* Paso a modo forced escribiendo  en ctrl_meas			*/
-	txBuffer[0] = REG_CTRL_MEAS & WRITE_MASK;
-	txBuffer[1] = TEMP_OVER_x1 | PRESS_OVER_x1 | FORCED_MODE;
-	if(BMP280_Write(txBuffer, 2) != BMP280_PORT_OK)
-		return BMP280_ERROR_COMM;
+	if(dev->config.mode != FORCED_MODE)
+		return BMP280_ERROR_INVALID_MODE;	/* En NORMAL_MODE el sensor se temporiza solo */
 
-	return BMP280_OK;
+	/* Paso a modo forced escribiendo en ctrl_meas, junto con los cambios de configuración pendientes */
+	return BMP280_Flush_Registers(dev, FORCED_MODE);
 }
 
 /**
@@ -250,23 +757,373 @@ bmp280_status_t	BMP280_Trigger_Measurement(void)
  * @return BMP280_DATA_RDY si los datos están listos, BMP280_DATA_NOT_RDY si aún mide,
  *         o un código de error si la lectura falla.
  */
-bmp280_status_t BMP280_Is_Measuring(void)
+bmp280_status_t BMP280_Is_Measuring(bmp280_t *dev)
 {
-	uint8_t txBuffer[2];
-	uint8_t rxBuffer[2];
+	uint8_t status;
 
-	txBuffer[0] = REG_STATUS | READ_MASK;
-	txBuffer[1] = DUMMY_PKG;
+	if(dev == NULL)
+		return BMP280_ERROR_PARAM;
 
-	if (BMP280_Transfer(txBuffer, rxBuffer, 2) != BMP280_PORT_OK)
+	dev->stats.statusReads++;
+	if (BMP280_Read_Registers(dev, REG_STATUS, &status, 1) != BMP280_OK)
 		return BMP280_ERROR_COMM;
 
-	if(rxBuffer[1] & STATUS_MEASURING)
+	if(status & STATUS_MEASURING)
 		return BMP280_DATA_NOT_RDY;
 	else
 		return BMP280_DATA_RDY;
 }
 
+void BMP280_Attach_Ring(bmp280_t *dev, bmp280_ring_t *ring)
+{
+	if(dev != NULL)
+		dev->ring = ring;
+}
+
+void BMP280_Set_Capture_Hook(bmp280_t *dev, bmp280_capture_hook_t hook)
+{
+	if(dev != NULL)
+		dev->capture = hook;
+}
+
+void BMP280_Get_Calibration_Block(const bmp280_t *dev, uint8_t *nvm)
+{
+	if(dev == NULL || nvm == NULL)
+		return;
+
+	const bmp280_calib_data_t *cal = &dev->calib;
+	const uint16_t words[BMP280_CALIB_SIZE / 2] = {
+		cal->dig_T1, (uint16_t)cal->dig_T2, (uint16_t)cal->dig_T3,
+		cal->dig_P1, (uint16_t)cal->dig_P2, (uint16_t)cal->dig_P3,
+		(uint16_t)cal->dig_P4, (uint16_t)cal->dig_P5, (uint16_t)cal->dig_P6,
+		(uint16_t)cal->dig_P7, (uint16_t)cal->dig_P8, (uint16_t)cal->dig_P9
+	};
+
+	for(uint8_t i = 0; i < BMP280_CALIB_SIZE / 2; i++)
+	{
+		nvm[2 * i]     = (uint8_t)(words[i] & 0xFF);		/* Mismo orden que los registros: LSB primero */
+		nvm[2 * i + 1] = (uint8_t)(words[i] >> 8);
+	}
+}
+
+bmp280_status_t BMP280_Refresh_Calibration(bmp280_t *dev)
+{
+	if(dev == NULL)
+		return BMP280_ERROR_PARAM;
+
+	if(BMP280_Cache_Invalidate(dev->cs) != BMP280_OK)
+		return BMP280_ERROR_COMM;
+
+	return BMP280_Get_Calibration(dev, CHIP_ID, false);
+}
+
+/**
+ * @brief Compara `ctrl_meas` y `config` leídos del sensor con la copia del driver.
+ *
+ * @param dev      Dispositivo leído.
+ * @param ctrlMeas Valor leído de `ctrl_meas`.
+ * @param config   Valor leído de `config`.
+ * @return true si el sensor conserva la configuración escrita.
+ */
+static bool BMP280_Shadow_Matches(const bmp280_t *dev, uint8_t ctrlMeas, uint8_t config)
+{
+	/* En modo forced los bits de modo vuelven solos a SLEEP, por eso se comparan sólo los osrs */
+	uint8_t mask = ((dev->regCtrlMeas & CTRL_MEAS_MODE) == NORMAL_MODE) ? 0xFF : (uint8_t)~CTRL_MEAS_MODE;
+
+	return (ctrlMeas & mask) == (dev->regCtrlMeas & mask) &&
+	       (config & (CONFIG_T_SB | CONFIG_FILTER)) == dev->regConfig;
+}
+
+bmp280_status_t BMP280_Verify_Registers(bmp280_t *dev)
+{
+	uint8_t data[2];
+	bmp280_status_t status;
+
+	if(dev == NULL)
+		return BMP280_ERROR_PARAM;
+
+	dev->stats.verifies++;
+	dev->verifyTick = BMP280_Port_Get_Tick();
+
+	/* ctrl_meas (0xF4) y config (0xF5) son contiguos: una sola lectura de dos bytes */
+	status = BMP280_Read_Registers(dev, REG_CTRL_MEAS, data, 2);
+	if(status != BMP280_OK)
+		return status;
+
+	if(!BMP280_Shadow_Matches(dev, data[0], data[1]))
+		return BMP280_ERROR_CONFIG;		/* El sensor perdió la configuración: no se arregla releyendo */
+
+	return BMP280_OK;
+}
+
+bmp280_status_t BMP280_Read_If_Ready(bmp280_t *dev)
+{
+	uint8_t data[BMP280_STATUS_BURST_SIZE];
+	bmp280_status_t status;
+
+	if(dev == NULL)
+		return BMP280_ERROR_PARAM;
+
+	dev->stats.statusReads++;
+	status = BMP280_Read_Registers(dev, REG_STATUS, data, BMP280_STATUS_BURST_SIZE);
+	if(status != BMP280_OK)
+		return status;
+
+	/* data[0] = status, data[1] = ctrl_meas, data[2] = config, data[3] = 0xF6 (reservado) */
+	if(data[0] & STATUS_MEASURING)
+		return BMP280_DATA_NOT_RDY;
+
+	/* La ráfaga incluye ctrl_meas y config: cada lectura vale como relectura de la copia */
+	dev->verifyTick = BMP280_Port_Get_Tick();
+	if(!BMP280_Shadow_Matches(dev, data[1], data[2]))
+		return BMP280_ERROR_CONFIG;		/* El sensor perdió la configuración: no se arregla releyendo */
+
+	return BMP280_Process_Burst(dev, &data[REG_PRESS_MSB - REG_STATUS]);
+}
+
+/**
+ * @brief Reinicia el sensor por software y le vuelve a escribir la configuración activa.
+ *
+ * Tras escribir CHIP_RESET, el sensor copia la NVM a sus registros (arranque de 2 ms típicos)
+ * y no responde al ID hasta terminar; se espera ese arranque una vez y luego se consulta hasta
+ * BMP280_RESET_POLLS veces, con 1 ms entre consultas. La calibración
+ * no cambia con el reset, por lo que se conserva la del descriptor.
+ *
+ * @param dev Dispositivo a reiniciar.
+ * @return BMP280_OK, o BMP280_ERROR_COMM si el sensor no volvió.
+ */
+static bmp280_status_t BMP280_Soft_Reset(bmp280_t *dev)
+{
+	uint8_t id = 0, status = STATUS_IM_UPDATE;
+
+	if(BMP280_Write_Register(dev, REG_RESET, CHIP_RESET) != BMP280_OK)
+		return BMP280_ERROR_COMM;
+
+	BMP280_Port_Delay_Ms(BMP280_STARTUP_MS);
+	for(uint8_t poll = 0; poll < BMP280_RESET_POLLS; poll++)
+	{
+		if(poll > 0)
+			BMP280_Port_Delay_Ms(1);
+		if(BMP280_Read_Registers(dev, REG_ID, &id, 1) == BMP280_OK && id == CHIP_ID &&
+		   BMP280_Read_Registers(dev, REG_STATUS, &status, 1) == BMP280_OK && !(status & STATUS_IM_UPDATE))
+			break;
+	}
+
+	if(id != CHIP_ID || (status & STATUS_IM_UPDATE))
+		return BMP280_ERROR_COMM;
+
+	/* Los registros volvieron a sus valores de reset: escritura completa de la configuración */
+	if(BMP280_Apply_Config(dev, &dev->config, true) != BMP280_OK)
+		return BMP280_ERROR_COMM;
+
+	dev->commErrors = 0;
+	return BMP280_OK;
+}
+
+/**
+ * @brief Indica si otro sensor del mismo bus tiene una lectura por DMA en curso.
+ *
+ * @param dev Dispositivo que pide el bus.
+ * @return true si reiniciar el periférico abortaría la transferencia de otro sensor.
+ */
+static bool BMP280_Bus_In_Use(const bmp280_t *dev)
+{
+	for(uint8_t i = 0; i < BMP280_DEVICE_COUNT; i++)
+	{
+		if(devices[i] != NULL && devices[i] != dev && devices[i]->bus == dev->bus && devices[i]->asyncPending)
+			return true;
+	}
+
+	return false;
+}
+
+bmp280_status_t BMP280_Recover(bmp280_t *dev)
+{
+	if(dev == NULL || dev->bus == NULL)
+		return BMP280_ERROR_PARAM;
+
+	/* Segundo nivel: reset por software, salvo que haya una ráfaga por DMA colgada */
+	if(!dev->asyncPending)
+	{
+		dev->stats.softResets++;
+		if(BMP280_Soft_Reset(dev) == BMP280_OK)
+			return BMP280_OK;
+	}
+
+	/* Tercer nivel: reinicio del periférico, sólo si ningún otro sensor tiene una ráfaga en curso;
+	 * si no, se reinicia únicamente este sensor (aborta su DMA). El bus arranca a la velocidad más
+	 * lenta y se le restituye la negociada (la caída por errores la sigue bajando si hace falta) */
+	dev->stats.busReinits++;
+	if(dev->bus->reset != NULL && !BMP280_Bus_In_Use(dev) && dev->bus->reset() != BMP280_PORT_OK)
+		return BMP280_ERROR_COMM;
+	if(dev->bus->init(dev->cs) != BMP280_PORT_OK)
+		return BMP280_ERROR_COMM;
+	dev->asyncPending = false;
+	if(dev->speed > 0 && dev->bus->setSpeed(dev->cs, dev->speed) != BMP280_PORT_OK)
+		dev->speed = 0;
+
+	return BMP280_Soft_Reset(dev);
+}
+
+bmp280_status_t BMP280_Set_Config(bmp280_t *dev, const bmp280_config_t *cfg)
+{
+	if(dev == NULL)
+		return BMP280_ERROR_PARAM;
+
+	return BMP280_Apply_Config(dev, cfg, false);
+}
+
+void BMP280_Get_Config(const bmp280_t *dev, bmp280_config_t *cfg)
+{
+	if(dev != NULL && cfg != NULL)
+		*cfg = dev->config;
+}
+
+bmp280_status_t BMP280_Set_Profile(bmp280_t *dev, bmp280_profile_t profile)
+{
+	if(dev == NULL || profile >= BMP280_PROFILE_COUNT)
+		return BMP280_ERROR_PARAM;
+
+	return BMP280_Apply_Config(dev, &profileTable[profile], false);
+}
+
+bmp280_status_t BMP280_Start_Continuous(bmp280_t *dev, uint8_t standby)
+{
+	if(dev == NULL)
+		return BMP280_ERROR_PARAM;
+
+	bmp280_config_t cfg = dev->config;
+
+	cfg.standby = standby;
+	cfg.mode = NORMAL_MODE;
+
+	return BMP280_Apply_Config(dev, &cfg, false);
+}
+
+bmp280_status_t BMP280_Stop_Continuous(bmp280_t *dev)
+{
+	if(dev == NULL)
+		return BMP280_ERROR_PARAM;
+
+	bmp280_config_t cfg = dev->config;
+
+	cfg.mode = FORCED_MODE;			/* Queda en SLEEP, listo para disparos en modo forced */
+
+	return BMP280_Apply_Config(dev, &cfg, false);
+}
+
+uint32_t BMP280_Get_Period_Ms(const bmp280_t *dev)
+{
+	uint32_t periodUs = standbyTableUs[dev->config.standby >> 5] + BMP280_Get_Measurement_Time_Us(dev);
+
+	return (periodUs + 999) / 1000;
+}
+
+uint32_t BMP280_Get_Measurement_Time_Us(const bmp280_t *dev)
+{
+	uint8_t osrsT = osrsTable[dev->config.osrsT >> 5];
+	uint8_t osrsP = osrsTable[dev->config.osrsP >> 2];
+	uint32_t timeUs = MEAS_TIME_BASE_US;
+
+	timeUs += MEAS_TIME_PER_OSRS_US * osrsT;
+	if(osrsP != 0)
+		timeUs += MEAS_TIME_PER_OSRS_US * osrsP + MEAS_TIME_PRESS_US;
+
+	return timeUs;
+}
+
+uint32_t BMP280_Get_Measurement_Time_Ms(const bmp280_t *dev)
+{
+	return (BMP280_Get_Measurement_Time_Us(dev) + 999) / 1000;
+}
+
+void BMP280_Get_Stats(const bmp280_t *dev, bmp280_stats_t *out)
+{
+	if(dev != NULL && out != NULL)
+		*out = dev->stats;
+}
+
+void BMP280_Reset_Stats(bmp280_t *dev)
+{
+	if(dev == NULL)
+		return;
+
+	dev->stats.samples = 0;
+	dev->stats.statusReads = 0;
+	dev->stats.transactions = 0;
+	dev->stats.clockFallbacks = 0;
+	dev->stats.retries = 0;
+	dev->stats.softResets = 0;
+	dev->stats.busReinits = 0;
+	dev->stats.registerWrites = 0;
+	dev->stats.verifies = 0;
+}
+
+/**
+ * @brief Verifica el bus a la velocidad actual leyendo el ID y la calibración varias veces.
+ *
+ * @param dev Dispositivo a verificar.
+ * @param crc CRC-32 de la calibración leída a la velocidad más lenta.
+ * @return true si todas las lecturas coinciden.
+ */
+static bool BMP280_Validate_Clock(bmp280_t *dev, uint32_t crc)
+{
+	uint8_t nvm[BMP280_CALIB_SIZE];
+	uint8_t id;
+
+	for(uint8_t i = 0; i < BMP280_CLOCK_VALIDATE_READS; i++)
+	{
+		if(BMP280_Read_Registers(dev, REG_ID, &id, 1) != BMP280_OK || id != CHIP_ID)
+			return false;
+
+		if(BMP280_Read_Registers(dev, REG_CALIB_START, nvm, BMP280_CALIB_SIZE) != BMP280_OK ||
+		   BMP280_Cache_Crc32(nvm, BMP280_CALIB_SIZE) != crc)
+			return false;
+	}
+
+	return true;
+}
+
+bmp280_status_t BMP280_Negotiate_Clock(bmp280_t *dev)
+{
+	uint8_t nvm[BMP280_CALIB_SIZE];
+	uint8_t speed = 0;
+	uint32_t crc;
+
+	if(dev == NULL)
+		return BMP280_ERROR_PARAM;
+
+	/* Referencia a la velocidad de arranque; mientras se negocia, dev->speed queda en 0 y
+	 * los errores de las velocidades a prueba no disparan la caída de velocidad */
+	dev->speed = 0;
+	if(dev->bus->setSpeed(dev->cs, 0) != BMP280_PORT_OK ||
+	   BMP280_Read_Registers(dev, REG_CALIB_START, nvm, BMP280_CALIB_SIZE) != BMP280_OK)
+		return BMP280_ERROR_COMM;
+	crc = BMP280_Cache_Crc32(nvm, BMP280_CALIB_SIZE);
+
+	while(speed + 1 < dev->bus->speedCount())
+	{
+		if(dev->bus->setSpeed(dev->cs, speed + 1) != BMP280_PORT_OK || !BMP280_Validate_Clock(dev, crc))
+			break;
+		speed++;
+	}
+
+	if(dev->bus->setSpeed(dev->cs, speed) != BMP280_PORT_OK)
+		return BMP280_ERROR_COMM;
+	dev->speed = speed;
+	dev->commErrors = 0;
+
+	return BMP280_OK;
+}
+
+uint32_t BMP280_Get_Clock_Hz(const bmp280_t *dev)
+{
+	if(dev == NULL)
+		return 0;
+
+	return dev->bus->speedHz(dev->speed);
+}
+
 /**
  * @brief Actualiza los valores de temperatura y presión del sensor.
  *
@@ -282,19 +1139,253 @@ bmp280_status_t BMP280_Update_Parameters(bmp280_t* dev)
 	if (dev == NULL)
 		return BMP280_ERROR_PARAM;
 
-	uint32_t rawTemp, rawPress;
+	uint8_t data[BMP280_DATA_SIZE];
 	bmp280_status_t status;
 
-	status = BMP280_Read_Raw_Parameters(dev, &rawTemp, &rawPress);
+	status = BMP280_Read_Raw_Parameters(dev, data);
 	if(status != BMP280_OK)
 		return status;
 
-	if(rawTemp == 0 || rawPress == 0)
-		return BMP280_ERROR_COMM;		/* Si los datos leídos son cero, indica un posible error en la linea MISO */
+	return BMP280_Process_Burst(dev, data);
+}
 
-	status = BMP280_Compensate_Values(dev, rawTemp, rawPress);
-	if(status != BMP280_OK)
-		return status;
+/**
+ * @brief Lanza la ráfaga de datos de ::BMP280_Start_Read_Async.
+ *
+ * @param dev Dispositivo a leer.
+ * @return BMP280_OK si la ráfaga comenzó, BMP280_BUSY si el bus lo tiene otro dispositivo,
+ *         BMP280_ERROR_COMM si no.
+ */
+static bmp280_status_t BMP280_Launch_Read_Async(bmp280_t *dev)
+{
+	bmp280_port_status_t status;
+
+	dev->stats.transactions++;
+
+	/* Sin DMA en el bus, la ráfaga se lee en el acto y queda lista para ::BMP280_Finish_Read_Async */
+	if(dev->bus->readAsync == NULL)
+	{
+		status = dev->bus->read(dev->cs, REG_PRESS_MSB, &dev->rxBuffer[1], BMP280_DATA_SIZE);
+		if(status == BMP280_PORT_BUSY)
+			return BMP280_BUSY;
+		dev->asyncResult = status;
+		return BMP280_OK;
+	}
+
+	dev->asyncPending = true;
+	status = dev->bus->readAsync(dev->cs, REG_PRESS_MSB, dev->txBuffer, dev->rxBuffer, BMP280_DATA_SIZE);
+	if(status != BMP280_PORT_OK)
+	{
+		dev->asyncPending = false;
+		return (status == BMP280_PORT_BUSY) ? BMP280_BUSY : BMP280_ERROR_COMM;
+	}
+
+	return BMP280_OK;
+}
+
+bmp280_status_t BMP280_Start_Read_Async(bmp280_t *dev)
+{
+	if(dev == NULL)
+		return BMP280_ERROR_PARAM;
+
+	if(dev->asyncPending)
+		return BMP280_ERROR_COMM;
+
+	/* La ráfaga de datos no incluye ctrl_meas ni config: se releen cada tanto */
+	if(BMP280_Port_Get_Tick() - dev->verifyTick >= BMP280_VERIFY_PERIOD_MS)
+	{
+		bmp280_status_t status = BMP280_Verify_Registers(dev);
+		if(status != BMP280_OK)
+			return status;
+	}
+
+	dev->asyncRetried = false;
+	return BMP280_Launch_Read_Async(dev);
+}
+
+bmp280_status_t BMP280_Finish_Read_Async(bmp280_t* dev)
+{
+	if (dev == NULL)
+		return BMP280_ERROR_PARAM;
+
+	if(dev->asyncPending)
+		return BMP280_DATA_NOT_RDY;
+
+	if(dev->asyncResult != BMP280_PORT_OK)
+	{
+		/* Primer nivel de recuperación, como en las lecturas bloqueantes: la ráfaga se lanza
+		 * una vez más (los registros de datos no cambian hasta la próxima conversión) */
+		if(!dev->asyncRetried)
+		{
+			bmp280_status_t status;
+
+			dev->asyncRetried = true;
+			dev->stats.retries++;
+			status = BMP280_Launch_Read_Async(dev);
+			if(status == BMP280_BUSY)
+				dev->asyncRetried = false;	/* Bus ocupado: la repetición se intenta en la próxima pasada */
+			if(status == BMP280_OK || status == BMP280_BUSY)
+				return BMP280_DATA_NOT_RDY;
+		}
+
+		BMP280_Comm_Error(dev);
+		return BMP280_ERROR_COMM;
+	}
+
+	return BMP280_Process_Burst(dev, &dev->rxBuffer[1]);
+}
+
+/**
+ * @brief Registra el fin de la ráfaga iniciada por ::BMP280_Start_Read_Async.
+ *
+ * Redefine el callback débil del puerto. Se ejecuta en la interrupción del DMA,
+ * por lo que sólo actualiza las banderas del dispositivo asociado al chip select;
+ * la compensación queda para el contexto principal.
+ *
+ * @param cs     Chip select de la transferencia finalizada.
+ * @param status Resultado de la transferencia.
+ */
+void BMP280_Transfer_Complete_Callback(uint8_t cs, bmp280_port_status_t status)
+{
+	if(cs >= BMP280_DEVICE_COUNT || devices[cs] == NULL)
+		return;
+
+	devices[cs]->asyncResult = status;
+	devices[cs]->asyncPending = false;
+}
+
+bmp280_status_t BMP280_Compensate_Batch(const bmp280_t *dev, const uint32_t *restrict rawTemp, const uint32_t *restrict rawPress,
+                                        float *restrict temperature, float *restrict pressure, uint32_t count)
+{
+	if(dev == NULL || rawTemp == NULL || rawPress == NULL || temperature == NULL || pressure == NULL)
+		return BMP280_ERROR_PARAM;
+
+	/* Copia local: el compilador sabe que los coeficientes no cambian dentro del lazo */
+	const bmp280_calib_float_t calF = dev->calibF;
+
+	if(calF.p1 == 0.0f)
+		return BMP280_ERROR_NAN;
+
+	for(uint32_t i = 0; i < count; i++)
+		(void)BMP280_Compensate_SP_Core(&calF, rawTemp[i], rawPress[i], &temperature[i], &pressure[i]);
 
 	return BMP280_OK;
 }
+
+bmp280_status_t BMP280_Set_Compensation(bmp280_t *dev, bmp280_comp_t mode)
+{
+	if(dev == NULL)
+		return BMP280_ERROR_PARAM;
+
+	if(mode != BMP280_COMP_FLOAT && mode != BMP280_COMP_INT && mode != BMP280_COMP_FLOAT_SP)
+		return BMP280_ERROR_PARAM;
+
+	dev->comp = mode;
+
+	return BMP280_OK;
+}
+
+#ifdef BMP280_BENCHMARK
+
+#include <math.h>
+#include "BENCH.h"
+
+/* Vector de ejemplo de la hoja de datos del BMP280 (sección 8.2) */
+#define BENCH_RAW_TEMP			((uint32_t) 519888)
+#define BENCH_RAW_PRESS			((uint32_t) 415148)
+#define BENCH_EXPECTED_TEMP		((int32_t)  2508)		/* 25,08 °C */
+#define BENCH_EXPECTED_PRESS	((uint32_t) 25767233)	/* 100653,25 Pa en Q24.8 (salida del código de referencia) */
+#define BENCH_TOLERANCE			0.01f					/* Diferencia admitida entre caminos (°C y hPa) */
+#define BENCH_BATCH				32						/* Muestras por llamada a BMP280_Compensate_Batch */
+
+static uint32_t benchRawTemp[BENCH_BATCH], benchRawPress[BENCH_BATCH];
+static float benchTemp[BENCH_BATCH], benchPress[BENCH_BATCH];
+
+static const bmp280_calib_data_t benchCalib = {
+	.dig_T1 = 27504, .dig_T2 = 26435, .dig_T3 = -1000,
+	.dig_P1 = 36477, .dig_P2 = -10685, .dig_P3 = 3024,
+	.dig_P4 = 2855,  .dig_P5 = 140,    .dig_P6 = -7,
+	.dig_P7 = 15500, .dig_P8 = -14600, .dig_P9 = 6000,
+};
+
+bmp280_status_t BMP280_Benchmark_Compensation(uint32_t iterations)
+{
+	bmp280_t sample = {0};
+	bmp280_t benchDev = {0};
+	uint32_t start, floatTicks, intTicks, spTicks, batchTicks, rounds;
+	float refTemp, refPress;
+	volatile float sink;
+
+	if(iterations == 0)
+		return BMP280_ERROR_PARAM;
+
+	/* Verificación contra el vector de referencia */
+	if(BMP280_Compensate_Int(&benchCalib, &sample, BENCH_RAW_TEMP, BENCH_RAW_PRESS) != BMP280_OK ||
+	   sample.temperatureInt != BENCH_EXPECTED_TEMP || sample.pressureInt != BENCH_EXPECTED_PRESS)
+		return BMP280_ERROR_SELF_TEST;
+
+	refTemp  = sample.temperature;
+	refPress = sample.pressure;
+
+	BMP280_Precompute_Float(&benchCalib, &benchDev.calibF);
+	if(BMP280_Compensate_Float_SP(&benchDev.calibF, &sample, BENCH_RAW_TEMP, BENCH_RAW_PRESS) != BMP280_OK ||
+	   fabsf(sample.temperature - refTemp) > BENCH_TOLERANCE || fabsf(sample.pressure - refPress) > BENCH_TOLERANCE)
+		return BMP280_ERROR_SELF_TEST;
+
+	for(uint32_t i = 0; i < BENCH_BATCH; i++)
+	{
+		benchRawTemp[i] = BENCH_RAW_TEMP + i;
+		benchRawPress[i] = BENCH_RAW_PRESS + i;
+	}
+	if(BMP280_Compensate_Batch(&benchDev, benchRawTemp, benchRawPress, benchTemp, benchPress, BENCH_BATCH) != BMP280_OK ||
+	   fabsf(benchTemp[0] - refTemp) > BENCH_TOLERANCE || fabsf(benchPress[0] - refPress) > BENCH_TOLERANCE)
+		return BMP280_ERROR_SELF_TEST;
+
+	BENCH_Init();
+
+	/* El crudo varía en cada iteración para que el compilador no pueda reutilizar resultados, y cada
+	   resultado va a `sink` para que no pueda descartar el cálculo */
+	start = BENCH_Now();
+	for(uint32_t i = 0; i < iterations; i++)
+	{
+		BMP280_Compensate_Float(&benchCalib, &sample, BENCH_RAW_TEMP + (i & 0xFF), BENCH_RAW_PRESS + (i & 0xFF));
+		sink = sample.pressure;
+	}
+	floatTicks = BENCH_Elapsed(start) / iterations;
+
+	start = BENCH_Now();
+	for(uint32_t i = 0; i < iterations; i++)
+	{
+		BMP280_Compensate_Int(&benchCalib, &sample, BENCH_RAW_TEMP + (i & 0xFF), BENCH_RAW_PRESS + (i & 0xFF));
+		sink = sample.pressure;
+	}
+	intTicks = BENCH_Elapsed(start) / iterations;
+
+	start = BENCH_Now();
+	for(uint32_t i = 0; i < iterations; i++)
+	{
+		BMP280_Compensate_Float_SP(&benchDev.calibF, &sample, BENCH_RAW_TEMP + (i & 0xFF), BENCH_RAW_PRESS + (i & 0xFF));
+		sink = sample.pressure;
+	}
+	spTicks = BENCH_Elapsed(start) / iterations;
+
+	rounds = (iterations + BENCH_BATCH - 1) / BENCH_BATCH;
+	start = BENCH_Now();
+	for(uint32_t i = 0; i < rounds; i++)
+	{
+		benchRawTemp[i % BENCH_BATCH]++;	/* Evita que se reutilice el resultado de la vuelta anterior */
+		BMP280_Compensate_Batch(&benchDev, benchRawTemp, benchRawPress, benchTemp, benchPress, BENCH_BATCH);
+		sink = benchPress[i % BENCH_BATCH];
+	}
+	batchTicks = BENCH_Elapsed(start) / (rounds * BENCH_BATCH);
+	(void)sink;
+
+	printf("Compensation FLOAT: %lu ticks (%lu ns)\r\n", (unsigned long)floatTicks, (unsigned long)BENCH_Ticks_To_Ns(floatTicks));
+	printf("Compensation INT:   %lu ticks (%lu ns)\r\n", (unsigned long)intTicks, (unsigned long)BENCH_Ticks_To_Ns(intTicks));
+	printf("Compensation SP:    %lu ticks (%lu ns)\r\n", (unsigned long)spTicks, (unsigned long)BENCH_Ticks_To_Ns(spTicks));
+	printf("Compensation BATCH: %lu ticks (%lu ns)\r\n", (unsigned long)batchTicks, (unsigned long)BENCH_Ticks_To_Ns(batchTicks));
+
+	return BMP280_OK;
+}
+
+#endif /* BMP280_BENCHMARK */
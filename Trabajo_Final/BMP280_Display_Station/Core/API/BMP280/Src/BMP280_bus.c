@@ -0,0 +1,142 @@
+/**
+ * @file BMP280_bus.c
+ * @author Ing. Lucas Kirschner
+ * @date 15 Oct 2026
+ * @brief Implementaciones SPI e I2C de la interfaz de transporte del BMP280.
+ */
+
+#include <stddef.h>
+
+#include "BMP280.h"
+#include "BMP280_bus.h"
+
+/* ---------------------------------------------------------------------------------------------
+ * SPI: el primer byte es la dirección con el bit 7 en 1 para leer y en 0 para escribir; en las
+ * lecturas la dirección se autoincrementa mientras el CS esté en bajo (hoja de datos, 5.3).
+ * -------------------------------------------------------------------------------------------*/
+
+static bmp280_port_status_t Bus_SPI_Init(uint8_t cs)
+{
+	uint8_t dummy = DUMMY_PKG;
+	bmp280_port_status_t status;
+
+	/* Inicializo el SPI la primera vez y dejo este sensor deseleccionado y a la velocidad más
+	 * lenta (::BMP280_Negotiate_Clock la sube). Sólo se aborta una ráfaga por DMA propia */
+	if(BMP280_Port_Init_Device(cs) != BMP280_PORT_OK)
+		return BMP280_PORT_ERROR;
+
+	/* Envio dato dummy para estabilizar la linea SCK. Si otro sensor está usando el bus, SCK ya
+	 * está activo y no hace falta */
+	status = BMP280_Write(cs, &dummy, 1);
+	return (status == BMP280_PORT_BUSY) ? BMP280_PORT_OK : status;
+}
+
+static bmp280_port_status_t Bus_SPI_Read(uint8_t cs, uint8_t reg, uint8_t *data, uint8_t size)
+{
+	uint8_t txBuffer[BMP280_BURST_MAX + 1];
+	uint8_t rxBuffer[BMP280_BURST_MAX + 1];
+	bmp280_port_status_t status;
+
+	if(size == 0 || size > BMP280_BURST_MAX)
+		return BMP280_PORT_ERROR;
+
+	txBuffer[0] = reg | READ_MASK;
+	for(uint8_t i = 1; i <= size; i++)
+		txBuffer[i] = DUMMY_PKG;
+
+	status = BMP280_Transfer(cs, txBuffer, rxBuffer, size + 1);
+	if(status != BMP280_PORT_OK)
+		return status;
+
+	for(uint8_t i = 0; i < size; i++)
+		data[i] = rxBuffer[i + 1];
+
+	return BMP280_PORT_OK;
+}
+
+static bmp280_port_status_t Bus_SPI_Write(uint8_t cs, const uint8_t *pairs, uint8_t size)
+{
+	uint8_t txBuffer[BMP280_BURST_MAX];
+
+	if(size == 0 || size > BMP280_BURST_MAX || (size & 1u))
+		return BMP280_PORT_ERROR;
+
+	for(uint8_t i = 0; i < size; i += 2)
+	{
+		txBuffer[i] = pairs[i] & WRITE_MASK;
+		txBuffer[i + 1] = pairs[i + 1];
+	}
+
+	return BMP280_Write(cs, txBuffer, size);
+}
+
+static bmp280_port_status_t Bus_SPI_Read_Async(uint8_t cs, uint8_t reg, uint8_t *tx, uint8_t *rx, uint8_t size)
+{
+	tx[0] = reg | READ_MASK;
+	for(uint8_t i = 1; i <= size; i++)
+		tx[i] = DUMMY_PKG;
+
+	/* El byte recibido durante la dirección queda en rx[0], como pide la interfaz */
+	return BMP280_Transfer_Async(cs, tx, rx, size + 1);
+}
+
+const bmp280_bus_t BMP280_Bus_SPI = {
+	.init = Bus_SPI_Init,
+	.reset = BMP280_Port_Init,
+	.read = Bus_SPI_Read,
+	.write = Bus_SPI_Write,
+	.readAsync = Bus_SPI_Read_Async,
+	.speedCount = BMP280_Port_Speed_Count,
+	.setSpeed = BMP280_Port_Set_Speed,
+	.speedHz = BMP280_Port_Get_Speed_Hz,
+	.minAddr = 0,
+	.maxAddr = BMP280_DEVICE_COUNT - 1,
+};
+
+/* ---------------------------------------------------------------------------------------------
+ * I2C: la dirección del registro va sin bit de lectura; las lecturas usan una condición de
+ * repeated start y también autoincrementan (hoja de datos, 5.2).
+ * -------------------------------------------------------------------------------------------*/
+
+static uint8_t Bus_I2C_Speed_Count(void)
+{
+	return 1;								/* El reloj lo fija el dueño del bus (HD44780_Port_Init) */
+}
+
+static bmp280_port_status_t Bus_I2C_Set_Speed(uint8_t addr, uint8_t speed)
+{
+	(void)addr;
+	return (speed == 0) ? BMP280_PORT_OK : BMP280_PORT_ERROR;
+}
+
+static uint32_t Bus_I2C_Speed_Hz(uint8_t speed)
+{
+	return (speed == 0) ? BMP280_I2C_Get_Clock_Hz() : 0;
+}
+
+static bmp280_port_status_t Bus_I2C_Init(uint8_t addr)
+{
+	(void)addr;
+	return BMP280_I2C_Init();
+}
+
+static bmp280_port_status_t Bus_I2C_Write(uint8_t addr, const uint8_t *pairs, uint8_t size)
+{
+	if(size == 0 || (size & 1u))
+		return BMP280_PORT_ERROR;
+
+	return BMP280_I2C_Write(addr, pairs, size);
+}
+
+const bmp280_bus_t BMP280_Bus_I2C = {
+	.init = Bus_I2C_Init,
+	.reset = NULL,
+	.read = BMP280_I2C_Read,
+	.write = Bus_I2C_Write,
+	.readAsync = NULL,
+	.speedCount = Bus_I2C_Speed_Count,
+	.setSpeed = Bus_I2C_Set_Speed,
+	.speedHz = Bus_I2C_Speed_Hz,
+	.minAddr = BMP280_I2C_ADDR_LOW,
+	.maxAddr = BMP280_I2C_ADDR_HIGH,
+};
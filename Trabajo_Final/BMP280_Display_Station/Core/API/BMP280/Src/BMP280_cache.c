@@ -0,0 +1,200 @@
+/**
+ * @file BMP280_cache.c
+ * @author Ing. Lucas Kirschner
+ * @date 15 Oct 2026
+ * @brief Implementación de la caché de calibración sobre el módulo NVM.
+ */
+
+#include <string.h>
+
+#include "BMP280_cache.h"
+#include "NVM.h"
+
+#define CACHE_MAGIC_VALID		0xCA1B0280u		/**< Entrada escrita (se programa primero) */
+#define CACHE_MAGIC_FREE		0xFFFFFFFFu		/**< Entrada borrada, disponible */
+#define CACHE_MAGIC_INVALID		0x00000000u		/**< Entrada descartada (sólo se apagan bits) */
+
+#define CACHE_CALIB_WORDS		((BMP280_CALIB_SIZE + 3u) / 4u)
+
+/**
+ * @brief Entrada de la caché. Su tamaño es múltiplo de 4 para programarla por palabras.
+ */
+typedef struct
+{
+	uint32_t magic;                        /**< CACHE_MAGIC_* */
+	uint32_t key;                          /**< chipId | (cs << 8) */
+	uint32_t calib[CACHE_CALIB_WORDS];     /**< Registros 0x88 ... 0x9F tal como se leyeron */
+	uint32_t crc;                          /**< CRC-32 de key y calib */
+} cache_record_t;
+
+#define CACHE_RECORD_WORDS		(sizeof(cache_record_t) / 4u)
+
+static cache_record_t pendingRecord;	/**< Entrada que espera el borrado de la región llena */
+static bool erasePending;				/**< Región llena: ::BMP280_Cache_Service la borra */
+
+uint32_t BMP280_Cache_Crc32(const uint8_t *data, uint32_t size)
+{
+	uint32_t crc = 0xFFFFFFFFu;
+
+	for(uint32_t i = 0; i < size; i++)
+	{
+		crc ^= data[i];
+		for(uint8_t bit = 0; bit < 8; bit++)
+			crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+	}
+
+	return ~crc;
+}
+
+static uint32_t Cache_Key(uint8_t cs, uint8_t chipId)
+{
+	return (uint32_t)chipId | ((uint32_t)cs << 8);
+}
+
+static uint32_t Cache_Record_Crc(const cache_record_t *record)
+{
+	return BMP280_Cache_Crc32((const uint8_t *)&record->key, sizeof(record->key) + sizeof(record->calib));
+}
+
+static uint32_t Cache_Slots(void)
+{
+	return NVM_Size() / sizeof(cache_record_t);
+}
+
+/**
+ * @brief Apaga la palabra mágica de una entrada para descartarla.
+ */
+static bmp280_status_t Cache_Discard(uint32_t slot)
+{
+	const uint32_t invalid = CACHE_MAGIC_INVALID;
+
+	if(NVM_Write(slot * sizeof(cache_record_t), &invalid, 1) != NVM_OK)
+		return BMP280_ERROR_COMM;
+
+	return BMP280_OK;
+}
+
+bool BMP280_Cache_Load(uint8_t cs, uint8_t chipId, uint8_t *nvm)
+{
+	cache_record_t record;
+	uint32_t key = Cache_Key(cs, chipId);
+
+	if(nvm == NULL)
+		return false;
+
+	if(erasePending && pendingRecord.magic == CACHE_MAGIC_VALID && pendingRecord.key == key)
+	{
+		memcpy(nvm, pendingRecord.calib, BMP280_CALIB_SIZE);
+		return true;
+	}
+
+	for(uint32_t slot = 0; slot < Cache_Slots(); slot++)
+	{
+		if(NVM_Read(slot * sizeof(cache_record_t), &record, sizeof(record)) != NVM_OK)
+			return false;
+
+		if(record.magic == CACHE_MAGIC_FREE)
+			break;							/* Las entradas se agregan en orden: no hay más */
+
+		/* Una entrada cortada por un corte de energía tiene la mágica pero no el CRC */
+		if(record.magic != CACHE_MAGIC_VALID || record.key != key || record.crc != Cache_Record_Crc(&record))
+			continue;
+
+		memcpy(nvm, record.calib, BMP280_CALIB_SIZE);
+		return true;
+	}
+
+	return false;
+}
+
+bmp280_status_t BMP280_Cache_Store(uint8_t cs, uint8_t chipId, const uint8_t *nvm)
+{
+	cache_record_t record;
+	uint32_t freeSlot = Cache_Slots();
+
+	if(nvm == NULL)
+		return BMP280_ERROR_PARAM;
+
+	/* Descarta las entradas anteriores de este chip select y busca el primer lugar libre */
+	for(uint32_t slot = 0; slot < Cache_Slots(); slot++)
+	{
+		if(NVM_Read(slot * sizeof(cache_record_t), &record, sizeof(record)) != NVM_OK)
+			return BMP280_ERROR_COMM;
+
+		if(record.magic == CACHE_MAGIC_FREE)
+		{
+			freeSlot = slot;
+			break;
+		}
+
+		if(record.magic == CACHE_MAGIC_VALID && (record.key >> 8) == cs)
+		{
+			if(Cache_Discard(slot) != BMP280_OK)
+				return BMP280_ERROR_COMM;
+		}
+	}
+
+	memset(&record, 0, sizeof(record));
+	record.magic = CACHE_MAGIC_VALID;
+	record.key = Cache_Key(cs, chipId);
+	memcpy(record.calib, nvm, BMP280_CALIB_SIZE);
+	record.crc = Cache_Record_Crc(&record);
+
+	if(freeSlot == Cache_Slots())
+	{
+		/* Región llena: el borrado bloquea del orden del segundo, por lo que no se hace aquí (dentro
+		   de BMP280_Init) sino en ::BMP280_Cache_Service. Mientras tanto la entrada queda en RAM */
+		pendingRecord = record;
+		erasePending = true;
+		return BMP280_OK;
+	}
+
+	if(NVM_Write(freeSlot * sizeof(cache_record_t), (const uint32_t *)&record, CACHE_RECORD_WORDS) != NVM_OK)
+		return BMP280_ERROR_COMM;
+
+	return BMP280_OK;
+}
+
+bmp280_status_t BMP280_Cache_Invalidate(uint8_t cs)
+{
+	cache_record_t record;
+
+	if(erasePending && (cs == BMP280_CACHE_ALL || (pendingRecord.key >> 8) == cs))
+		pendingRecord.magic = CACHE_MAGIC_INVALID;
+
+	for(uint32_t slot = 0; slot < Cache_Slots(); slot++)
+	{
+		if(NVM_Read(slot * sizeof(cache_record_t), &record, sizeof(record)) != NVM_OK)
+			return BMP280_ERROR_COMM;
+
+		if(record.magic == CACHE_MAGIC_FREE)
+			break;
+
+		if(record.magic == CACHE_MAGIC_VALID && (cs == BMP280_CACHE_ALL || (record.key >> 8) == cs))
+		{
+			if(Cache_Discard(slot) != BMP280_OK)
+				return BMP280_ERROR_COMM;
+		}
+	}
+
+	return BMP280_OK;
+}
+
+bmp280_status_t BMP280_Cache_Service(void)
+{
+	if(!erasePending)
+		return BMP280_OK;
+
+	/* Las demás entradas se pierden: se vuelven a leer del sensor en su próxima inicialización */
+	if(NVM_Erase() != NVM_OK)
+		return BMP280_ERROR_COMM;
+	erasePending = false;
+
+	if(pendingRecord.magic != CACHE_MAGIC_VALID)
+		return BMP280_OK;
+
+	if(NVM_Write(0, (const uint32_t *)&pendingRecord, CACHE_RECORD_WORDS) != NVM_OK)
+		return BMP280_ERROR_COMM;
+
+	return BMP280_OK;
+}
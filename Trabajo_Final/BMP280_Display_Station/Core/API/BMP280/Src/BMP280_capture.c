@@ -0,0 +1,70 @@
+/**
+ * @file BMP280_capture.c
+ * @author Ing. Lucas Kirschner
+ * @date 15 Oct 2026
+ * @brief Codificación y decodificación del formato de captura del BMP280.
+ */
+
+#include <string.h>
+
+#include "BMP280_capture.h"
+
+static const uint8_t captureMagic[4] = { 'B', 'M', 'P', 'C' };
+
+static void Capture_Put_U32(uint8_t *buf, uint32_t value)
+{
+	buf[0] = (uint8_t)(value);
+	buf[1] = (uint8_t)(value >> 8);
+	buf[2] = (uint8_t)(value >> 16);
+	buf[3] = (uint8_t)(value >> 24);
+}
+
+static uint32_t Capture_Get_U32(const uint8_t *buf)
+{
+	return (uint32_t)buf[0] | ((uint32_t)buf[1] << 8) | ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);
+}
+
+void BMP280_Capture_Write_Header(uint8_t *buf, uint8_t chipId, const uint8_t *nvm)
+{
+	if(buf == NULL || nvm == NULL)
+		return;
+
+	memcpy(buf, captureMagic, sizeof(captureMagic));
+	buf[4] = BMP280_CAPTURE_VERSION;
+	buf[5] = chipId;
+	buf[6] = 0;
+	buf[7] = 0;
+	memcpy(&buf[8], nvm, BMP280_CALIB_SIZE);
+}
+
+void BMP280_Capture_Write_Record(uint8_t *buf, uint32_t tick, const uint8_t *raw)
+{
+	if(buf == NULL || raw == NULL)
+		return;
+
+	Capture_Put_U32(buf, tick);
+	memcpy(&buf[4], raw, BMP280_DATA_SIZE);
+}
+
+bmp280_status_t BMP280_Capture_Read_Header(const uint8_t *buf, uint32_t size, uint8_t *chipId, uint8_t *nvm)
+{
+	if(buf == NULL || chipId == NULL || nvm == NULL || size < BMP280_CAPTURE_HEADER_SIZE)
+		return BMP280_ERROR_PARAM;
+
+	if(memcmp(buf, captureMagic, sizeof(captureMagic)) != 0 || buf[4] != BMP280_CAPTURE_VERSION)
+		return BMP280_ERROR_PARAM;
+
+	*chipId = buf[5];
+	memcpy(nvm, &buf[8], BMP280_CALIB_SIZE);
+
+	return BMP280_OK;
+}
+
+void BMP280_Capture_Read_Record(const uint8_t *buf, uint32_t *tick, uint8_t *raw)
+{
+	if(buf == NULL || tick == NULL || raw == NULL)
+		return;
+
+	*tick = Capture_Get_U32(buf);
+	memcpy(raw, &buf[4], BMP280_DATA_SIZE);
+}
@@ -10,16 +10,68 @@
 
 #include "BMP280_port.h"
 
+#ifndef BMP280_PORT_HOST
+
+#include "I2C_BUS.h"
+
 #define SPI_TIMEOUT_MS	50	/**< Timeout para las transmisiones SPI */
+#define DMA_IRQ_PRIORITY	5	/**< Prioridad de las interrupciones de DMA del SPI */
+#define I2C_TIMEOUT_MS	50	/**< Timeout para las transmisiones I2C */
+#define I2C_CLOCK_HZ	100000	/**< SCL si el BMP280 es el primero en usar el bus */
+
+DMA_HandleTypeDef hdma_spi3_rx;
+DMA_HandleTypeDef hdma_spi3_tx;
+
+static volatile bool asyncBusy = false;	/**< Transferencia por DMA en curso */
+static uint8_t asyncCs;					/**< Chip select de la transferencia por DMA en curso */
+static bool busReady = false;			/**< SPI3 y su DMA ya inicializados */
+
+/* Prescalers de SCK indexados por velocidad, del más lento (el de arranque) al más rápido */
+static const uint32_t prescalerTable[] = {
+	SPI_BAUDRATEPRESCALER_32, SPI_BAUDRATEPRESCALER_16, SPI_BAUDRATEPRESCALER_8,
+	SPI_BAUDRATEPRESCALER_4, SPI_BAUDRATEPRESCALER_2
+};
+static const uint8_t prescalerDiv[] = { 32, 16, 8, 4, 2 };
+
+#define SPEED_TABLE_SIZE	(sizeof(prescalerDiv) / sizeof(prescalerDiv[0]))
+
+static uint8_t speedCount = 1;						/**< Velocidades que no superan BMP280_SPI_MAX_HZ */
+static uint8_t csSpeed[BMP280_DEVICE_COUNT];		/**< Velocidad elegida para cada sensor */
+static uint8_t busSpeed;							/**< Velocidad programada en el SPI */
+
+/**
+ * @brief Pin de chip select de cada sensor.
+ */
+typedef struct
+{
+	GPIO_TypeDef *port;
+	uint16_t pin;
+} bmp280_cs_t;
+
+/* Tabla de chip selects, indexada por el `cs` de cada dispositivo. Agregar una entrada por sensor */
+static const bmp280_cs_t csTable[BMP280_DEVICE_COUNT] = {
+	{ SPI3_CS_GPIO_Port, SPI3_CS_Pin },
+};
 
 /**
  * @brief Activa el pin Chip Select (CS) del sensor BMP280.
  *
  * Establece el pin CS en nivel bajo, iniciando una comunicación SPI.
+ *
+ * @param cs Índice del chip select.
  */
-static void BMP280_CS_Enable(void)
+static void BMP280_CS_Enable(uint8_t cs)
 {
-    HAL_GPIO_WritePin(SPI3_CS_GPIO_Port, SPI3_CS_Pin, GPIO_PIN_RESET);
+    /* Con el SPI inactivo se puede cambiar el prescaler; la HAL lo vuelve a habilitar al transmitir */
+    if (busSpeed != csSpeed[cs])
+    {
+        __HAL_SPI_DISABLE(&hspi3);
+        MODIFY_REG(hspi3.Instance->CR1, SPI_CR1_BR, prescalerTable[csSpeed[cs]]);
+        hspi3.Init.BaudRatePrescaler = prescalerTable[csSpeed[cs]];
+        busSpeed = csSpeed[cs];
+    }
+
+    HAL_GPIO_WritePin(csTable[cs].port, csTable[cs].pin, GPIO_PIN_RESET);
 }
 
 /**
@@ -27,10 +79,59 @@ static void BMP280_CS_Enable(void)
  *
  * Establece el pin CS en nivel alto, finalizando una comunicación SPI.
  * El flanco ascendente de este pin marca el fin de una lectura por ráfaga.
+ *
+ * @param cs Índice del chip select.
+ */
+static void BMP280_CS_Disable(uint8_t cs)
+{
+    HAL_GPIO_WritePin(csTable[cs].port, csTable[cs].pin, GPIO_PIN_SET);
+}
+
+/**
+ * @brief Configura los streams de DMA del SPI3 y los vincula al manejador `hspi3`.
+ *
+ * SPI3_RX usa DMA1 Stream0 y SPI3_TX usa DMA1 Stream5, ambos en el canal 0.
+ *
+ * @return BMP280_PORT_OK si la configuración fue exitosa.
  */
-static void BMP280_CS_Disable(void)
+static bmp280_port_status_t BMP280_DMA_Init(void)
 {
-    HAL_GPIO_WritePin(SPI3_CS_GPIO_Port, SPI3_CS_Pin, GPIO_PIN_SET);
+	__HAL_RCC_DMA1_CLK_ENABLE();
+
+	hdma_spi3_rx.Instance = DMA1_Stream0;
+	hdma_spi3_rx.Init.Channel = DMA_CHANNEL_0;
+	hdma_spi3_rx.Init.Direction = DMA_PERIPH_TO_MEMORY;
+	hdma_spi3_rx.Init.PeriphInc = DMA_PINC_DISABLE;
+	hdma_spi3_rx.Init.MemInc = DMA_MINC_ENABLE;
+	hdma_spi3_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+	hdma_spi3_rx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+	hdma_spi3_rx.Init.Mode = DMA_NORMAL;
+	hdma_spi3_rx.Init.Priority = DMA_PRIORITY_HIGH;
+	hdma_spi3_rx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+	if (HAL_DMA_Init(&hdma_spi3_rx) != HAL_OK)
+		return BMP280_PORT_ERROR;
+	__HAL_LINKDMA(&hspi3, hdmarx, hdma_spi3_rx);
+
+	hdma_spi3_tx.Instance = DMA1_Stream5;
+	hdma_spi3_tx.Init.Channel = DMA_CHANNEL_0;
+	hdma_spi3_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+	hdma_spi3_tx.Init.PeriphInc = DMA_PINC_DISABLE;
+	hdma_spi3_tx.Init.MemInc = DMA_MINC_ENABLE;
+	hdma_spi3_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+	hdma_spi3_tx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+	hdma_spi3_tx.Init.Mode = DMA_NORMAL;
+	hdma_spi3_tx.Init.Priority = DMA_PRIORITY_HIGH;
+	hdma_spi3_tx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+	if (HAL_DMA_Init(&hdma_spi3_tx) != HAL_OK)
+		return BMP280_PORT_ERROR;
+	__HAL_LINKDMA(&hspi3, hdmatx, hdma_spi3_tx);
+
+	HAL_NVIC_SetPriority(DMA1_Stream0_IRQn, DMA_IRQ_PRIORITY, 0);
+	HAL_NVIC_EnableIRQ(DMA1_Stream0_IRQn);
+	HAL_NVIC_SetPriority(DMA1_Stream5_IRQn, DMA_IRQ_PRIORITY, 0);
+	HAL_NVIC_EnableIRQ(DMA1_Stream5_IRQn);
+
+	return BMP280_PORT_OK;
 }
 
 /**
@@ -45,13 +146,45 @@ static bmp280_port_status_t BMP280_ConvertStatus(HAL_StatusTypeDef hal_status)
     {
         case HAL_OK:
             return BMP280_PORT_OK;
+        case HAL_BUSY:
+            return BMP280_PORT_BUSY;
         default:
             return BMP280_PORT_ERROR;
     }
 }
 
+/**
+ * @brief Aborta la transferencia por DMA en curso y la notifica como fallida.
+ *
+ * Libera el CS del sensor dueño y le invoca ::BMP280_Transfer_Complete_Callback con
+ * BMP280_PORT_ERROR, como lo haría la interrupción de error del SPI.
+ */
+static void BMP280_Abort_Async(void)
+{
+	HAL_SPI_Abort(&hspi3);
+
+	/* Si la interrupción del DMA llegó antes del abort, el dueño ya fue notificado */
+	if (asyncBusy)
+	{
+		BMP280_CS_Disable(asyncCs);
+		asyncBusy = false;
+		BMP280_Transfer_Complete_Callback(asyncCs, BMP280_PORT_ERROR);
+	}
+}
+
 bmp280_port_status_t BMP280_Port_Init(void)
 {
+	  /* Si quedó una transferencia por DMA en curso (p. ej. tras un error), se aborta y se avisa
+	   * a su dueño, que de otro modo la seguiría esperando */
+	  if (asyncBusy)
+		  BMP280_Abort_Async();
+
+	  busReady = false;
+
+	  /* Todos los sensores deseleccionados antes de hablar con cualquiera de ellos */
+	  for (uint8_t cs = 0; cs < BMP280_DEVICE_COUNT; cs++)
+		  BMP280_CS_Disable(cs);
+
 	  hspi3.Instance = SPI3;
 	  hspi3.Init.Mode = SPI_MODE_MASTER;
 	  hspi3.Init.Direction = SPI_DIRECTION_2LINES;
@@ -59,7 +192,7 @@ bmp280_port_status_t BMP280_Port_Init(void)
 	  hspi3.Init.CLKPolarity = SPI_POLARITY_LOW;
 	  hspi3.Init.CLKPhase = SPI_PHASE_1EDGE;
 	  hspi3.Init.NSS = SPI_NSS_SOFT;
-	  hspi3.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_32;
+	  hspi3.Init.BaudRatePrescaler = prescalerTable[busSpeed];
 	  hspi3.Init.FirstBit = SPI_FIRSTBIT_MSB;
 	  hspi3.Init.TIMode = SPI_TIMODE_DISABLE;
 	  hspi3.Init.CRCCalculation = SPI_CRCCALCULATION_DISABLE;
@@ -69,41 +202,229 @@ bmp280_port_status_t BMP280_Port_Init(void)
 	    return BMP280_PORT_ERROR;
 	  }
 
+	  speedCount = 1;
+	  while (speedCount < SPEED_TABLE_SIZE && BMP280_Port_Get_Speed_Hz(speedCount) <= BMP280_SPI_MAX_HZ)
+		  speedCount++;
+
+	  if (BMP280_DMA_Init() != BMP280_PORT_OK)
+		  return BMP280_PORT_ERROR;
+
+	  busReady = true;
 	  return BMP280_PORT_OK;
 }
 
-bmp280_port_status_t BMP280_Write(uint8_t *dataWrite, uint8_t size)
+bmp280_port_status_t BMP280_Port_Init_Device(uint8_t cs)
 {
-    if (dataWrite == NULL || size == 0)
+    if (cs >= BMP280_DEVICE_COUNT)
         return BMP280_PORT_ERROR;
 
-    BMP280_CS_Enable();
+    /* El periférico es compartido: se inicializa una sola vez */
+    if (!busReady && BMP280_Port_Init() != BMP280_PORT_OK)
+        return BMP280_PORT_ERROR;
+
+    /* Sólo se aborta la transferencia propia; la de otro sensor sigue su curso */
+    if (asyncBusy && asyncCs == cs)
+        BMP280_Abort_Async();
+
+    BMP280_CS_Disable(cs);
+    csSpeed[cs] = 0;
+
+    return BMP280_PORT_OK;
+}
+
+bmp280_port_status_t BMP280_Write(uint8_t cs, uint8_t *dataWrite, uint8_t size)
+{
+    if (cs >= BMP280_DEVICE_COUNT || dataWrite == NULL || size == 0)
+        return BMP280_PORT_ERROR;
+
+    if (asyncBusy)
+        return BMP280_PORT_BUSY;
+
+    BMP280_CS_Enable(cs);
     HAL_StatusTypeDef status = HAL_SPI_Transmit(&hspi3, dataWrite, size, SPI_TIMEOUT_MS);
-    BMP280_CS_Disable();
+    BMP280_CS_Disable(cs);
 
     return BMP280_ConvertStatus(status);
 }
 
-bmp280_port_status_t BMP280_Read(uint8_t *dataRead, uint8_t size)
+bmp280_port_status_t BMP280_Read(uint8_t cs, uint8_t *dataRead, uint8_t size)
 {
-    if (dataRead == NULL || size == 0)
+    if (cs >= BMP280_DEVICE_COUNT || dataRead == NULL || size == 0)
         return BMP280_PORT_ERROR;
 
-    BMP280_CS_Enable();
+    if (asyncBusy)
+        return BMP280_PORT_BUSY;
+
+    BMP280_CS_Enable(cs);
     HAL_StatusTypeDef status = HAL_SPI_Receive(&hspi3, dataRead, size, SPI_TIMEOUT_MS);
-    BMP280_CS_Disable();
+    BMP280_CS_Disable(cs);
 
     return BMP280_ConvertStatus(status);
 }
 
-bmp280_port_status_t BMP280_Transfer(uint8_t *dataWrite, uint8_t *dataRead, uint8_t size)
+bmp280_port_status_t BMP280_Transfer(uint8_t cs, uint8_t *dataWrite, uint8_t *dataRead, uint8_t size)
 {
-    if (dataWrite == NULL || dataRead == NULL || size == 0)
+    if (cs >= BMP280_DEVICE_COUNT || dataWrite == NULL || dataRead == NULL || size == 0)
         return BMP280_PORT_ERROR;
 
-    BMP280_CS_Enable();
+    if (asyncBusy)
+        return BMP280_PORT_BUSY;
+
+    BMP280_CS_Enable(cs);
     HAL_StatusTypeDef status = HAL_SPI_TransmitReceive(&hspi3, dataWrite, dataRead, size, SPI_TIMEOUT_MS);
-    BMP280_CS_Disable();
+    BMP280_CS_Disable(cs);
+
+    return BMP280_ConvertStatus(status);
+}
+
+bmp280_port_status_t BMP280_Transfer_Async(uint8_t cs, uint8_t *dataWrite, uint8_t *dataRead, uint8_t size)
+{
+    if (cs >= BMP280_DEVICE_COUNT || dataWrite == NULL || dataRead == NULL || size == 0)
+        return BMP280_PORT_ERROR;
+
+    if (asyncBusy)
+        return BMP280_PORT_BUSY;
+
+    asyncBusy = true;
+    asyncCs = cs;
+    BMP280_CS_Enable(cs);
+    HAL_StatusTypeDef status = HAL_SPI_TransmitReceive_DMA(&hspi3, dataWrite, dataRead, size);
+    if (status != HAL_OK)
+    {
+        BMP280_CS_Disable(cs);
+        asyncBusy = false;
+    }
+
+    return BMP280_ConvertStatus(status);
+}
+
+bool BMP280_Port_Is_Busy(void)
+{
+    return asyncBusy;
+}
+
+uint8_t BMP280_Port_Speed_Count(void)
+{
+    return speedCount;
+}
+
+bmp280_port_status_t BMP280_Port_Set_Speed(uint8_t cs, uint8_t speed)
+{
+    if (cs >= BMP280_DEVICE_COUNT || speed >= speedCount)
+        return BMP280_PORT_ERROR;
+
+    csSpeed[cs] = speed;
+    return BMP280_PORT_OK;
+}
+
+uint32_t BMP280_Port_Get_Speed_Hz(uint8_t speed)
+{
+    if (speed >= SPEED_TABLE_SIZE)
+        return 0;
+
+    return HAL_RCC_GetPCLK1Freq() / prescalerDiv[speed];
+}
+
+uint32_t BMP280_Port_Get_Tick(void)
+{
+    return HAL_GetTick();
+}
+
+void BMP280_Port_Delay_Ms(uint32_t ms)
+{
+    HAL_Delay(ms);
+}
+
+bmp280_port_status_t BMP280_I2C_Init(void)
+{
+    if (hi2c1.State != HAL_I2C_STATE_RESET)
+        return BMP280_PORT_OK;
+
+    hi2c1.Instance = I2C1;
+    hi2c1.Init.ClockSpeed = I2C_CLOCK_HZ;
+    hi2c1.Init.DutyCycle = I2C_DUTYCYCLE_2;
+    hi2c1.Init.OwnAddress1 = 0;
+    hi2c1.Init.AddressingMode = I2C_ADDRESSINGMODE_7BIT;
+    hi2c1.Init.DualAddressMode = I2C_DUALADDRESS_DISABLE;
+    hi2c1.Init.OwnAddress2 = 0;
+    hi2c1.Init.GeneralCallMode = I2C_GENERALCALL_DISABLE;
+    hi2c1.Init.NoStretchMode = I2C_NOSTRETCH_DISABLE;
+
+    return BMP280_ConvertStatus(HAL_I2C_Init(&hi2c1));
+}
+
+bmp280_port_status_t BMP280_I2C_Read(uint8_t addr, uint8_t reg, uint8_t *data, uint8_t size)
+{
+    if (data == NULL || size == 0)
+        return BMP280_PORT_ERROR;
+
+    /* Si el display está volcando por DMA, no se espera: el driver reintenta en otra pasada */
+    if (!I2C_BUS_Acquire(I2C_BUS_SENSOR))
+        return BMP280_PORT_BUSY;
+
+    HAL_StatusTypeDef status = HAL_I2C_Mem_Read(&hi2c1, (uint16_t)(addr << 1), reg, I2C_MEMADD_SIZE_8BIT,
+                                                data, size, I2C_TIMEOUT_MS);
+    I2C_BUS_Release(I2C_BUS_SENSOR);
+
+    return BMP280_ConvertStatus(status);
+}
+
+bmp280_port_status_t BMP280_I2C_Write(uint8_t addr, const uint8_t *data, uint8_t size)
+{
+    if (data == NULL || size == 0)
+        return BMP280_PORT_ERROR;
+
+    if (!I2C_BUS_Acquire(I2C_BUS_SENSOR))
+        return BMP280_PORT_BUSY;
+
+    HAL_StatusTypeDef status = HAL_I2C_Master_Transmit(&hi2c1, (uint16_t)(addr << 1), (uint8_t *)data,
+                                                       size, I2C_TIMEOUT_MS);
+    I2C_BUS_Release(I2C_BUS_SENSOR);
 
     return BMP280_ConvertStatus(status);
 }
+
+uint32_t BMP280_I2C_Get_Clock_Hz(void)
+{
+    return hi2c1.Init.ClockSpeed;
+}
+
+__weak void BMP280_Transfer_Complete_Callback(uint8_t cs, bmp280_port_status_t status)
+{
+    (void)cs;
+    (void)status;
+}
+
+/**
+ * @brief Callback de la HAL al completar una transferencia SPI por DMA.
+ *
+ * El flanco ascendente del CS cierra la lectura por ráfaga del BMP280.
+ *
+ * @param hspi Manejador del SPI que finalizó la transferencia.
+ */
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    if (hspi != &hspi3)
+        return;
+
+    BMP280_CS_Disable(asyncCs);
+    asyncBusy = false;
+    BMP280_Transfer_Complete_Callback(asyncCs, BMP280_PORT_OK);
+}
+
+/**
+ * @brief Callback de la HAL ante un error en una transferencia SPI por DMA.
+ *
+ * @param hspi Manejador del SPI en el que ocurrió el error.
+ */
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+    if (hspi != &hspi3 || !asyncBusy)
+        return;
+
+    BMP280_CS_Disable(asyncCs);
+    asyncBusy = false;
+    BMP280_Transfer_Complete_Callback(asyncCs, BMP280_PORT_ERROR);
+}
+
+#endif /* BMP280_PORT_HOST */
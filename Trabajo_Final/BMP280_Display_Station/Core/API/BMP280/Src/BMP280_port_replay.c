@@ -0,0 +1,281 @@
+/**
+ * @file BMP280_port_replay.c
+ * @author Ing. Lucas Kirschner
+ * @date 15 Oct 2026
+ * @brief Transporte de host que reproduce una captura a través de la interfaz de BMP280_port.h.
+ *
+ * Sólo se compila con `BMP280_PORT_REPLAY`, en cuyo caso reemplaza a BMP280_port.c.
+ * Emula el protocolo SPI del BMP280 sobre un mapa de 256 registros: el primer byte de cada
+ * transacción es la dirección (bit 7 en 1 para leer) y la dirección se autoincrementa en las
+ * lecturas; las escrituras son pares dirección/valor. Cada lectura que abarque el registro
+ * REG_PRESS_MSB carga antes la siguiente ráfaga de la captura.
+ */
+
+#include "BMP280_port.h"
+
+#ifdef BMP280_PORT_REPLAY
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "BMP280_capture.h"
+
+static uint8_t regs[256];					/**< Mapa de registros emulado */
+static const uint8_t *records;				/**< Primer registro de la captura */
+static uint32_t recordCount;
+static uint32_t nextRecord;
+static uint32_t currentTick;				/**< Tick de la última ráfaga entregada */
+static uint8_t *fileBuffer;					/**< Captura leída con ::BMP280_Replay_Open */
+
+bmp280_status_t BMP280_Replay_Load(const uint8_t *data, uint32_t size)
+{
+	uint8_t chipId;
+	uint8_t nvm[BMP280_CALIB_SIZE];
+
+	if(BMP280_Capture_Read_Header(data, size, &chipId, nvm) != BMP280_OK)
+		return BMP280_ERROR_PARAM;
+
+	for(uint32_t i = 0; i < sizeof(regs); i++)
+		regs[i] = 0;
+	regs[REG_ID] = chipId;
+	for(uint8_t i = 0; i < BMP280_CALIB_SIZE; i++)
+		regs[REG_CALIB_START + i] = nvm[i];
+
+	records = data + BMP280_CAPTURE_HEADER_SIZE;
+	recordCount = (size - BMP280_CAPTURE_HEADER_SIZE) / BMP280_CAPTURE_RECORD_SIZE;
+	nextRecord = 0;
+	currentTick = 0;
+
+	return BMP280_OK;
+}
+
+bmp280_status_t BMP280_Replay_Open(const char *path)
+{
+	FILE *file;
+	long size;
+	uint8_t *buffer;
+
+	if(path == NULL || (file = fopen(path, "rb")) == NULL)
+		return BMP280_ERROR_COMM;
+
+	if(fseek(file, 0, SEEK_END) != 0 || (size = ftell(file)) < 0 || fseek(file, 0, SEEK_SET) != 0)
+	{
+		fclose(file);
+		return BMP280_ERROR_COMM;
+	}
+
+	/* La captura anterior sigue activa hasta que la nueva se cargue sin errores */
+	buffer = malloc((size_t)size);
+	if(buffer == NULL || fread(buffer, 1, (size_t)size, file) != (size_t)size)
+	{
+		free(buffer);
+		fclose(file);
+		return BMP280_ERROR_COMM;
+	}
+	fclose(file);
+
+	if(BMP280_Replay_Load(buffer, (uint32_t)size) != BMP280_OK)
+	{
+		free(buffer);
+		return BMP280_ERROR_PARAM;
+	}
+
+	free(fileBuffer);
+	fileBuffer = buffer;
+
+	return BMP280_OK;
+}
+
+void BMP280_Replay_Rewind(void)
+{
+	nextRecord = 0;
+}
+
+uint32_t BMP280_Replay_Remaining(void)
+{
+	return recordCount - nextRecord;
+}
+
+/**
+ * @brief Copia la siguiente ráfaga de la captura a los registros de datos.
+ *
+ * @return BMP280_PORT_ERROR si la captura se agotó.
+ */
+static bmp280_port_status_t Replay_Next_Sample(void)
+{
+	if(nextRecord >= recordCount)
+		return BMP280_PORT_ERROR;
+
+	BMP280_Capture_Read_Record(records + nextRecord * BMP280_CAPTURE_RECORD_SIZE, &currentTick, &regs[REG_PRESS_MSB]);
+	nextRecord++;
+
+	return BMP280_PORT_OK;
+}
+
+/**
+ * @brief Ejecuta una transacción SPI contra el mapa de registros.
+ */
+static bmp280_port_status_t Replay_Transaction(const uint8_t *dataWrite, uint8_t *dataRead, uint8_t size)
+{
+	uint8_t reg = dataWrite[0] | READ_MASK;	/* En SPI el bit 7 de la dirección indica lectura/escritura */
+
+	if(dataWrite[0] & READ_MASK)
+	{
+		if(reg <= REG_PRESS_MSB && (uint32_t)reg + size - 1u > REG_PRESS_MSB && Replay_Next_Sample() != BMP280_PORT_OK)
+			return BMP280_PORT_ERROR;
+
+		if(dataRead != NULL)
+		{
+			dataRead[0] = 0;
+			for(uint8_t i = 1; i < size; i++)
+				dataRead[i] = regs[(uint8_t)(reg + i - 1)];
+		}
+		return BMP280_PORT_OK;
+	}
+
+	for(uint8_t i = 0; i + 1u < size; i += 2)
+	{
+		reg = dataWrite[i] | READ_MASK;
+		if(reg == REG_RESET && dataWrite[i + 1] == CHIP_RESET)
+		{
+			regs[REG_CTRL_MEAS] = 0;
+			regs[REG_CONFIG] = 0;
+		}
+		else
+			regs[reg] = dataWrite[i + 1];
+	}
+
+	if(dataRead != NULL)
+	{
+		for(uint8_t i = 0; i < size; i++)
+			dataRead[i] = 0;
+	}
+
+	return BMP280_PORT_OK;
+}
+
+bmp280_port_status_t BMP280_Port_Init(void)
+{
+	return (records != NULL) ? BMP280_PORT_OK : BMP280_PORT_ERROR;
+}
+
+bmp280_port_status_t BMP280_Port_Init_Device(uint8_t cs)
+{
+	return (cs < BMP280_DEVICE_COUNT) ? BMP280_Port_Init() : BMP280_PORT_ERROR;
+}
+
+bmp280_port_status_t BMP280_Write(uint8_t cs, uint8_t *dataWrite, uint8_t size)
+{
+	if (cs >= BMP280_DEVICE_COUNT || dataWrite == NULL || size == 0)
+		return BMP280_PORT_ERROR;
+
+	return Replay_Transaction(dataWrite, NULL, size);
+}
+
+bmp280_port_status_t BMP280_Read(uint8_t cs, uint8_t *dataRead, uint8_t size)
+{
+	if (cs >= BMP280_DEVICE_COUNT || dataRead == NULL || size == 0)
+		return BMP280_PORT_ERROR;
+
+	for(uint8_t i = 0; i < size; i++)
+		dataRead[i] = 0;					/* Sin dirección previa el sensor no entrega datos útiles */
+
+	return BMP280_PORT_OK;
+}
+
+bmp280_port_status_t BMP280_Transfer(uint8_t cs, uint8_t *dataWrite, uint8_t *dataRead, uint8_t size)
+{
+	if (cs >= BMP280_DEVICE_COUNT || dataWrite == NULL || dataRead == NULL || size == 0)
+		return BMP280_PORT_ERROR;
+
+	return Replay_Transaction(dataWrite, dataRead, size);
+}
+
+bmp280_port_status_t BMP280_Transfer_Async(uint8_t cs, uint8_t *dataWrite, uint8_t *dataRead, uint8_t size)
+{
+	if (cs >= BMP280_DEVICE_COUNT || dataWrite == NULL || dataRead == NULL || size == 0)
+		return BMP280_PORT_ERROR;
+
+	/* La "transferencia" termina en el acto: se notifica como lo haría la interrupción del DMA */
+	BMP280_Transfer_Complete_Callback(cs, Replay_Transaction(dataWrite, dataRead, size));
+
+	return BMP280_PORT_OK;
+}
+
+bool BMP280_Port_Is_Busy(void)
+{
+	return false;
+}
+
+/* Por I2C se reproduce la misma captura, sea cual sea la dirección del esclavo */
+
+bmp280_port_status_t BMP280_I2C_Init(void)
+{
+	return BMP280_Port_Init();
+}
+
+bmp280_port_status_t BMP280_I2C_Read(uint8_t addr, uint8_t reg, uint8_t *data, uint8_t size)
+{
+	uint8_t txBuffer[BMP280_BURST_MAX + 1] = { 0 };
+	uint8_t rxBuffer[BMP280_BURST_MAX + 1];
+
+	(void)addr;
+	if(data == NULL || size == 0 || size > BMP280_BURST_MAX)
+		return BMP280_PORT_ERROR;
+
+	txBuffer[0] = reg | READ_MASK;
+	if(Replay_Transaction(txBuffer, rxBuffer, size + 1) != BMP280_PORT_OK)
+		return BMP280_PORT_ERROR;
+
+	for(uint8_t i = 0; i < size; i++)
+		data[i] = rxBuffer[i + 1];
+
+	return BMP280_PORT_OK;
+}
+
+bmp280_port_status_t BMP280_I2C_Write(uint8_t addr, const uint8_t *data, uint8_t size)
+{
+	uint8_t txBuffer[BMP280_BURST_MAX];
+
+	(void)addr;
+	if(data == NULL || size == 0 || size > BMP280_BURST_MAX)
+		return BMP280_PORT_ERROR;
+
+	for(uint8_t i = 0; i < size; i++)
+		txBuffer[i] = (i & 1u) ? data[i] : (data[i] & WRITE_MASK);
+
+	return Replay_Transaction(txBuffer, NULL, size);
+}
+
+uint32_t BMP280_I2C_Get_Clock_Hz(void)
+{
+	return 0;
+}
+
+uint8_t BMP280_Port_Speed_Count(void)
+{
+	return 1;								/* La captura no depende del reloj del bus */
+}
+
+bmp280_port_status_t BMP280_Port_Set_Speed(uint8_t cs, uint8_t speed)
+{
+	return (cs < BMP280_DEVICE_COUNT && speed == 0) ? BMP280_PORT_OK : BMP280_PORT_ERROR;
+}
+
+uint32_t BMP280_Port_Get_Speed_Hz(uint8_t speed)
+{
+	(void)speed;
+	return 0;
+}
+
+uint32_t BMP280_Port_Get_Tick(void)
+{
+	return currentTick;
+}
+
+void BMP280_Port_Delay_Ms(uint32_t ms)
+{
+	(void)ms;								/* El tiempo lo marcan los ticks de la captura */
+}
+
+#endif /* BMP280_PORT_REPLAY */
@@ -0,0 +1,602 @@
+/**
+ * @file BMP280_port_sim.c
+ * @author Ing. Lucas Kirschner
+ * @date 15 Oct 2026
+ * @brief Transporte de host que simula el BMP280 a nivel de registros (ver BMP280_sim.h).
+ *
+ * Sólo se compila con `BMP280_PORT_SIM`, en cuyo caso reemplaza a BMP280_port.c.
+ * Los tiempos de conversión son los típicos de la hoja de datos (sección 3.8.1, tabla 13):
+ * 1 ms + 2 ms * osrs_t + (2 ms * osrs_p + 0,5 ms), de modo que el plazo máximo que espera el
+ * driver siempre alcanza, como con un sensor real.
+ */
+
+#include "BMP280_port.h"
+
+#ifdef BMP280_PORT_SIM
+
+#include <string.h>
+
+#include "BMP280.h"
+#include "BMP280_sim.h"
+
+#define SIM_MODE_SLEEP		0
+#define SIM_MODE_FORCED		1
+#define SIM_MODE_NORMAL		3
+
+#define SIM_ADC_MAX			0xFFFFFu		/* Valores crudos de 20 bits */
+#define SIM_ADC_SKIPPED		0x80000u		/* Valor de los registros de datos sin medir */
+
+/* Ejemplo de calibración de la hoja de datos (sección 8.2) */
+static const uint8_t defaultNvm[BMP280_CALIB_SIZE] = {
+	0x70, 0x6B, 0x43, 0x67, 0x18, 0xFC, 0x7D, 0x8E, 0x43, 0xD6, 0xD0, 0x0B,
+	0x27, 0x0B, 0x8C, 0x00, 0xF9, 0xFF, 0x8C, 0x3C, 0xF8, 0xC6, 0x70, 0x17
+};
+
+static const uint8_t osrsCount[8] = { 0, 1, 2, 4, 8, 16, 16, 16 };
+static const uint32_t standbyUs[8] = { 500, 62500, 125000, 250000, 500000, 1000000, 2000000, 4000000 };
+static const uint8_t filterCoeff[8] = { 1, 2, 4, 8, 16, 16, 16, 16 };
+static const uint8_t dropBits[8] = { 0, 4, 3, 2, 1, 0, 0, 0 };		/* 20 - (16 + log2(osrs)) */
+
+static uint8_t regs[256];					/**< Mapa de registros */
+static uint8_t nvm[BMP280_CALIB_SIZE];
+static bool nvmSet = false;
+static bmp280_sim_waveform_t waveform;
+static uint32_t spiHz = BMP280_SIM_SPI_HZ_DEFAULT;		/**< SCK de la velocidad 0 */
+static uint32_t maxReliableHz;							/**< 0: el bus nunca corrompe datos */
+static uint8_t csSpeed[BMP280_DEVICE_COUNT];
+
+static uint64_t nowNs;						/**< Reloj virtual */
+static uint8_t mode;
+static uint64_t convEndNs;					/**< Fin de la conversión en curso (forced) o de la próxima (normal) */
+static uint64_t resetEndNs;					/**< Fin de la copia de la NVM tras un CHIP_RESET */
+static uint32_t faultCount;					/**< Transacciones que todavía deben fallar */
+static double iirTemp, iirPress;			/**< Estado del filtro IIR, en cuentas del ADC */
+static bool iirValid;
+static bmp280_sim_stats_t stats;
+
+/* Coeficientes decodificados de la NVM para la compensación inversa */
+static double T1, T2, T3, P1, P2, P3, P4, P5, P6, P7, P8, P9;
+
+static int16_t Sim_S16(uint8_t index)
+{
+	return (int16_t)(nvm[index] | (nvm[index + 1] << 8));
+}
+
+static uint16_t Sim_U16(uint8_t index)
+{
+	return (uint16_t)(nvm[index] | (nvm[index + 1] << 8));
+}
+
+static void Sim_Load_Nvm(void)
+{
+	memcpy(&regs[REG_CALIB_START], nvm, BMP280_CALIB_SIZE);
+
+	T1 = Sim_U16(0);  T2 = Sim_S16(2);  T3 = Sim_S16(4);
+	P1 = Sim_U16(6);  P2 = Sim_S16(8);  P3 = Sim_S16(10);
+	P4 = Sim_S16(12); P5 = Sim_S16(14); P6 = Sim_S16(16);
+	P7 = Sim_S16(18); P8 = Sim_S16(20); P9 = Sim_S16(22);
+}
+
+/**
+ * @brief Fórmula flotante de la hoja de datos (sección 8.1), usada para invertir la compensación.
+ */
+static double Sim_Comp_Temp(uint32_t adcT, double *tFine)
+{
+	double var1 = ((double)adcT / 16384.0 - T1 / 1024.0) * T2;
+	double var2 = ((double)adcT / 131072.0 - T1 / 8192.0) * ((double)adcT / 131072.0 - T1 / 8192.0) * T3;
+
+	*tFine = var1 + var2;
+	return (var1 + var2) / 5120.0;
+}
+
+static double Sim_Comp_Press(uint32_t adcP, double tFine)
+{
+	double var1 = tFine / 2.0 - 64000.0;
+	double var2 = var1 * var1 * P6 / 32768.0;
+	var2 = var2 + var1 * P5 * 2.0;
+	var2 = var2 / 4.0 + P4 * 65536.0;
+	var1 = (P3 * var1 * var1 / 524288.0 + P2 * var1) / 524288.0;
+	var1 = (1.0 + var1 / 32768.0) * P1;
+	if(var1 == 0.0)
+		return 0.0;
+
+	double p = 1048576.0 - (double)adcP;
+	p = (p - var2 / 4096.0) * 6250.0 / var1;
+	var1 = P9 * p * p / 2147483648.0;
+	var2 = p * P8 / 32768.0;
+
+	return p + (var1 + var2 + P7) / 16.0;
+}
+
+/**
+ * @brief Busca el valor crudo de temperatura cuya compensación alcanza `target` (creciente).
+ */
+static uint32_t Sim_Invert_Temp(double target, double *tFine)
+{
+	uint32_t lo = 0, hi = SIM_ADC_MAX;
+
+	while(lo < hi)
+	{
+		uint32_t mid = lo + (hi - lo) / 2;
+		if(Sim_Comp_Temp(mid, tFine) < target)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	Sim_Comp_Temp(lo, tFine);
+
+	return lo;
+}
+
+/**
+ * @brief Busca el valor crudo de presión cuya compensación alcanza `target` (decreciente).
+ */
+static uint32_t Sim_Invert_Press(double target, double tFine)
+{
+	uint32_t lo = 0, hi = SIM_ADC_MAX;
+
+	while(lo < hi)
+	{
+		uint32_t mid = lo + (hi - lo) / 2;
+		if(Sim_Comp_Press(mid, tFine) > target)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return lo;
+}
+
+static void Sim_Default_Waveform(uint64_t timeUs, double *temperature, double *pressure)
+{
+	(void)timeUs;
+	*temperature = 25.0;
+	*pressure = 100000.0;
+}
+
+static uint32_t Sim_Conversion_Us(void)
+{
+	uint8_t osrsT = osrsCount[regs[REG_CTRL_MEAS] >> 5];
+	uint8_t osrsP = osrsCount[(regs[REG_CTRL_MEAS] >> 2) & 0x07];
+	uint32_t timeUs = 1000 + 2000 * osrsT;
+
+	if(osrsP != 0)
+		timeUs += 2000 * osrsP + 500;
+
+	return timeUs;
+}
+
+static void Sim_Put_Adc(uint8_t reg, uint32_t adc)
+{
+	regs[reg]     = (uint8_t)(adc >> 12);
+	regs[reg + 1] = (uint8_t)(adc >> 4);
+	regs[reg + 2] = (uint8_t)((adc & 0x0F) << 4);
+}
+
+/**
+ * @brief Completa una conversión en el instante `timeNs` y actualiza los registros de datos.
+ *
+ * Sin filtro, la resolución es de 16 + log2(osrs) bits (osrs = 1 ... 16 muestras, ver dropBits); con filtro, de 20 bits.
+ */
+static void Sim_Latch(uint64_t timeNs)
+{
+	uint8_t osrsT = osrsCount[regs[REG_CTRL_MEAS] >> 5];
+	uint8_t osrsP = osrsCount[(regs[REG_CTRL_MEAS] >> 2) & 0x07];
+	uint8_t coeff = filterCoeff[(regs[REG_CONFIG] >> 2) & 0x07];
+	double temperature, pressure, tFine;
+	uint32_t adcT, adcP;
+
+	(waveform != NULL ? waveform : Sim_Default_Waveform)(timeNs / 1000u, &temperature, &pressure);
+
+	adcT = Sim_Invert_Temp(temperature, &tFine);
+	adcP = Sim_Invert_Press(pressure, tFine);
+
+	if(!iirValid || coeff == 1)
+	{
+		iirTemp = adcT;
+		iirPress = adcP;
+		iirValid = true;
+	}
+	else
+	{
+		iirTemp = (iirTemp * (coeff - 1) + adcT) / coeff;
+		iirPress = (iirPress * (coeff - 1) + adcP) / coeff;
+	}
+
+	adcT = (uint32_t)(iirTemp + 0.5);
+	adcP = (uint32_t)(iirPress + 0.5);
+	if(coeff == 1)
+	{
+		adcT &= ~((1u << dropBits[regs[REG_CTRL_MEAS] >> 5]) - 1u);
+		adcP &= ~((1u << dropBits[(regs[REG_CTRL_MEAS] >> 2) & 0x07]) - 1u);
+	}
+
+	Sim_Put_Adc(REG_PRESS_MSB, osrsP != 0 ? adcP : SIM_ADC_SKIPPED);
+	Sim_Put_Adc(REG_TEMP_MSB, osrsT != 0 ? adcT : SIM_ADC_SKIPPED);
+	stats.conversions++;
+}
+
+/**
+ * @brief Procesa las conversiones que terminaron hasta el instante actual.
+ */
+static void Sim_Update(void)
+{
+	if(mode == SIM_MODE_FORCED && nowNs >= convEndNs)
+	{
+		Sim_Latch(convEndNs);
+		mode = SIM_MODE_SLEEP;
+		regs[REG_CTRL_MEAS] &= (uint8_t)~CTRL_MEAS_MODE;	/* Vuelve solo a sleep */
+	}
+
+	while(mode == SIM_MODE_NORMAL && nowNs >= convEndNs)
+	{
+		Sim_Latch(convEndNs);
+		convEndNs += 1000ull * (standbyUs[regs[REG_CONFIG] >> 5] + Sim_Conversion_Us());
+	}
+}
+
+static uint8_t Sim_Status(void)
+{
+	uint64_t convNs = 1000ull * Sim_Conversion_Us();
+
+	if(mode == SIM_MODE_FORCED || (mode == SIM_MODE_NORMAL && nowNs + convNs >= convEndNs))
+		return STATUS_MEASURING;
+
+	return 0;
+}
+
+static void Sim_Power_On(void)
+{
+	memset(regs, 0, sizeof(regs));
+	regs[REG_ID] = CHIP_ID;
+	Sim_Put_Adc(REG_PRESS_MSB, SIM_ADC_SKIPPED);
+	Sim_Put_Adc(REG_TEMP_MSB, SIM_ADC_SKIPPED);
+	if(!nvmSet)
+		memcpy(nvm, defaultNvm, sizeof(nvm));
+	Sim_Load_Nvm();
+	mode = SIM_MODE_SLEEP;
+	iirValid = false;
+}
+
+static void Sim_Write_Register(uint8_t reg, uint8_t value)
+{
+	switch(reg)
+	{
+	case REG_RESET:
+		if(value == CHIP_RESET)
+		{
+			Sim_Power_On();
+			resetEndNs = nowNs + 1000ull * BMP280_SIM_STARTUP_US;
+		}
+		break;
+
+	case REG_CONFIG:
+		regs[REG_CONFIG] = value;
+		break;
+
+	case REG_CTRL_MEAS:
+		regs[REG_CTRL_MEAS] = value;
+		switch(value & CTRL_MEAS_MODE)
+		{
+		case SLEEP_MODE:
+			mode = SIM_MODE_SLEEP;
+			break;
+		case NORMAL_MODE:
+			if(mode != SIM_MODE_NORMAL)
+				convEndNs = nowNs + 1000ull * Sim_Conversion_Us();
+			mode = SIM_MODE_NORMAL;
+			break;
+		default:							/* 01 y 10: forced */
+			mode = SIM_MODE_FORCED;
+			convEndNs = nowNs + 1000ull * Sim_Conversion_Us();
+			break;
+		}
+		break;
+
+	default:								/* El resto de los registros es de sólo lectura */
+		break;
+	}
+}
+
+/**
+ * @brief Contabiliza una transacción y avanza el reloj virtual con su duración.
+ *
+ * @param hz   Frecuencia del reloj del bus.
+ * @param bits Ciclos de reloj de la transacción.
+ * @param size Bytes transferidos.
+ */
+static void Sim_Bus_Time(uint32_t hz, uint32_t bits, uint8_t size)
+{
+	uint64_t ns = BMP280_SIM_CS_OVERHEAD_NS + (1000000000ull * bits) / hz;
+
+	stats.transactions++;
+	stats.bytes += size;
+	stats.busTimeNs += ns;
+	nowNs += ns;
+}
+
+/**
+ * @brief Por encima de la frecuencia confiable, MISO se muestrea un bit tarde.
+ */
+static void Sim_Corrupt(uint8_t *dataRead, uint8_t size)
+{
+	for(uint8_t i = 0; i < size; i++)
+		dataRead[i] = (uint8_t)((dataRead[i] << 1) | (i + 1u < size ? dataRead[i + 1] >> 7 : 1u));
+}
+
+/**
+ * @brief Aplica una trama con el formato SPI al mapa de registros.
+ */
+static void Sim_Access(const uint8_t *dataWrite, uint8_t *dataRead, uint8_t size)
+{
+	Sim_Update();
+
+	/* Mientras copia la NVM el sensor ignora las escrituras y sólo informa im_update */
+	if(nowNs < resetEndNs)
+	{
+		if(dataRead == NULL)
+			return;
+		memset(dataRead, 0, size);
+		for(uint8_t i = 1; dataWrite != NULL && (dataWrite[0] & READ_MASK) && i < size; i++)
+			if((uint8_t)((dataWrite[0] + i - 1) | READ_MASK) == REG_STATUS)
+				dataRead[i] = STATUS_IM_UPDATE;
+		return;
+	}
+
+	if(dataWrite != NULL && (dataWrite[0] & READ_MASK))
+	{
+		uint8_t reg = dataWrite[0];
+		if(dataRead != NULL)
+		{
+			dataRead[0] = 0;
+			for(uint8_t i = 1; i < size; i++)
+			{
+				uint8_t addr = (uint8_t)(reg + i - 1) | READ_MASK;
+				dataRead[i] = (addr == REG_STATUS) ? Sim_Status() : regs[addr];
+			}
+		}
+	}
+	else if(dataWrite != NULL)
+	{
+		for(uint8_t i = 0; i + 1u < size; i += 2)
+			Sim_Write_Register(dataWrite[i] | READ_MASK, dataWrite[i + 1]);
+		if(dataRead != NULL)
+			memset(dataRead, 0, size);
+	}
+	else if(dataRead != NULL)
+		memset(dataRead, 0, size);
+}
+
+/**
+ * @brief Consume una de las fallas pedidas con ::BMP280_Sim_Fail_Next.
+ */
+static bool Sim_Fault(void)
+{
+	if(faultCount == 0)
+		return false;
+
+	faultCount--;
+	return true;
+}
+
+static bmp280_port_status_t Sim_Transaction(uint8_t cs, const uint8_t *dataWrite, uint8_t *dataRead, uint8_t size)
+{
+	uint32_t hz = BMP280_Port_Get_Speed_Hz(csSpeed[cs]);
+
+	Sim_Bus_Time(hz, 8u * size, size);
+	if(Sim_Fault())
+		return BMP280_PORT_ERROR;
+
+	Sim_Access(dataWrite, dataRead, size);
+
+	if(dataRead != NULL && maxReliableHz != 0 && hz > maxReliableHz)
+		Sim_Corrupt(dataRead, size);
+
+	return BMP280_PORT_OK;
+}
+
+void BMP280_Sim_Reset(void)
+{
+	nowNs = 0;
+	resetEndNs = 0;
+	faultCount = 0;
+	memset(&stats, 0, sizeof(stats));
+	Sim_Power_On();
+}
+
+void BMP280_Sim_Set_Waveform(bmp280_sim_waveform_t fn)
+{
+	waveform = fn;
+}
+
+void BMP280_Sim_Set_Calibration(const uint8_t *data)
+{
+	if(data == NULL)
+		return;
+
+	memcpy(nvm, data, sizeof(nvm));
+	nvmSet = true;
+	Sim_Load_Nvm();
+}
+
+void BMP280_Sim_Set_Spi_Clock(uint32_t hz)
+{
+	if(hz != 0)
+		spiHz = hz;
+}
+
+void BMP280_Sim_Fail_Next(uint32_t count)
+{
+	faultCount = count;
+}
+
+void BMP280_Sim_Set_Max_Reliable_Hz(uint32_t hz)
+{
+	maxReliableHz = hz;
+}
+
+void BMP280_Sim_Advance_Us(uint32_t us)
+{
+	nowNs += 1000ull * us;
+	Sim_Update();
+}
+
+uint64_t BMP280_Sim_Get_Time_Us(void)
+{
+	return nowNs / 1000u;
+}
+
+void BMP280_Sim_Get_Stats(bmp280_sim_stats_t *out)
+{
+	if(out != NULL)
+		*out = stats;
+}
+
+bmp280_port_status_t BMP280_Port_Init(void)
+{
+	if(regs[REG_ID] != CHIP_ID)
+		Sim_Power_On();						/* Primer uso sin ::BMP280_Sim_Reset */
+
+	return BMP280_PORT_OK;
+}
+
+bmp280_port_status_t BMP280_Port_Init_Device(uint8_t cs)
+{
+	if(cs >= BMP280_DEVICE_COUNT)
+		return BMP280_PORT_ERROR;
+
+	csSpeed[cs] = 0;
+	return BMP280_Port_Init();
+}
+
+bmp280_port_status_t BMP280_Write(uint8_t cs, uint8_t *dataWrite, uint8_t size)
+{
+	if (cs >= BMP280_DEVICE_COUNT || dataWrite == NULL || size == 0)
+		return BMP280_PORT_ERROR;
+
+	return Sim_Transaction(cs, dataWrite, NULL, size);
+}
+
+bmp280_port_status_t BMP280_Read(uint8_t cs, uint8_t *dataRead, uint8_t size)
+{
+	if (cs >= BMP280_DEVICE_COUNT || dataRead == NULL || size == 0)
+		return BMP280_PORT_ERROR;
+
+	return Sim_Transaction(cs, NULL, dataRead, size);
+}
+
+bmp280_port_status_t BMP280_Transfer(uint8_t cs, uint8_t *dataWrite, uint8_t *dataRead, uint8_t size)
+{
+	if (cs >= BMP280_DEVICE_COUNT || dataWrite == NULL || dataRead == NULL || size == 0)
+		return BMP280_PORT_ERROR;
+
+	return Sim_Transaction(cs, dataWrite, dataRead, size);
+}
+
+bmp280_port_status_t BMP280_Transfer_Async(uint8_t cs, uint8_t *dataWrite, uint8_t *dataRead, uint8_t size)
+{
+	if (cs >= BMP280_DEVICE_COUNT || dataWrite == NULL || dataRead == NULL || size == 0)
+		return BMP280_PORT_ERROR;
+
+	/* La transferencia termina en el acto: se notifica como lo haría la interrupción del DMA */
+	BMP280_Transfer_Complete_Callback(cs, Sim_Transaction(cs, dataWrite, dataRead, size));
+
+	return BMP280_PORT_OK;
+}
+
+bool BMP280_Port_Is_Busy(void)
+{
+	return false;
+}
+
+uint8_t BMP280_Port_Speed_Count(void)
+{
+	uint8_t count = 1;
+
+	while(count < 8 && (spiHz << count) <= BMP280_SPI_MAX_HZ)
+		count++;
+
+	return count;
+}
+
+bmp280_port_status_t BMP280_Port_Set_Speed(uint8_t cs, uint8_t speed)
+{
+	if(cs >= BMP280_DEVICE_COUNT || speed >= BMP280_Port_Speed_Count())
+		return BMP280_PORT_ERROR;
+
+	csSpeed[cs] = speed;
+	return BMP280_PORT_OK;
+}
+
+uint32_t BMP280_Port_Get_Speed_Hz(uint8_t speed)
+{
+	return (speed < 8) ? spiHz << speed : 0;	/* Como el prescaler del SPI: cada velocidad duplica a la anterior */
+}
+
+/* El mismo sensor simulado responde por I2C en cualquiera de sus dos direcciones. Cada byte
+ * ocupa 9 ciclos de SCL (ACK incluido) más 2 por las condiciones de start y stop */
+
+static bool Sim_I2C_Address(uint8_t addr)
+{
+	return addr == BMP280_SIM_I2C_ADDR_LOW || addr == BMP280_SIM_I2C_ADDR_HIGH;
+}
+
+bmp280_port_status_t BMP280_I2C_Init(void)
+{
+	return BMP280_Port_Init();
+}
+
+bmp280_port_status_t BMP280_I2C_Read(uint8_t addr, uint8_t reg, uint8_t *data, uint8_t size)
+{
+	uint8_t txBuffer[BMP280_BURST_MAX + 1] = { 0 };
+	uint8_t rxBuffer[BMP280_BURST_MAX + 1];
+
+	if(data == NULL || size == 0 || size > BMP280_BURST_MAX)
+		return BMP280_PORT_ERROR;
+
+	/* Dirección + registro, repeated start, dirección + datos */
+	Sim_Bus_Time(BMP280_SIM_I2C_HZ, 9u * (3u + size) + 3u, (uint8_t)(3u + size));
+	if(!Sim_I2C_Address(addr) || Sim_Fault())
+		return BMP280_PORT_ERROR;			/* Sin ACK */
+
+	txBuffer[0] = reg | READ_MASK;
+	Sim_Access(txBuffer, rxBuffer, size + 1);
+	memcpy(data, &rxBuffer[1], size);
+
+	return BMP280_PORT_OK;
+}
+
+bmp280_port_status_t BMP280_I2C_Write(uint8_t addr, const uint8_t *data, uint8_t size)
+{
+	uint8_t txBuffer[BMP280_BURST_MAX];
+
+	if(data == NULL || size == 0 || size > BMP280_BURST_MAX)
+		return BMP280_PORT_ERROR;
+
+	Sim_Bus_Time(BMP280_SIM_I2C_HZ, 9u * (1u + size) + 2u, (uint8_t)(1u + size));
+	if(!Sim_I2C_Address(addr) || Sim_Fault())
+		return BMP280_PORT_ERROR;
+
+	for(uint8_t i = 0; i < size; i++)
+		txBuffer[i] = (i & 1u) ? data[i] : (data[i] & WRITE_MASK);
+	Sim_Access(txBuffer, NULL, size);
+
+	return BMP280_PORT_OK;
+}
+
+uint32_t BMP280_I2C_Get_Clock_Hz(void)
+{
+	return BMP280_SIM_I2C_HZ;
+}
+
+uint32_t BMP280_Port_Get_Tick(void)
+{
+	return (uint32_t)(nowNs / 1000000u);
+}
+
+void BMP280_Port_Delay_Ms(uint32_t ms)
+{
+	BMP280_Sim_Advance_Us(1000u * ms);
+}
+
+#endif /* BMP280_PORT_SIM */
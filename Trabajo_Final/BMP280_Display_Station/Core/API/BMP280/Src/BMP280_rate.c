@@ -0,0 +1,150 @@
+/**
+ * @file BMP280_rate.c
+ * @author Ing. Lucas Kirschner
+ * @date 15 Oct 2026
+ * @brief Implementación del control adaptivo de la tasa de muestreo.
+ */
+
+#include <math.h>
+#include <stddef.h>
+
+#include "BMP280_rate.h"
+
+const bmp280_rate_policy_t BMP280_Rate_Default_Policy = {
+	.levels = {
+		{ .periodMs = 5000, .osrsT = TEMP_OVER_x1, .osrsP = PRESS_OVER_x1, .standby = STANDBY_4000 },
+		{ .periodMs = 1000, .osrsT = TEMP_OVER_x1, .osrsP = PRESS_OVER_x4, .standby = STANDBY_1000 },
+		{ .periodMs = 100,  .osrsT = TEMP_OVER_x2, .osrsP = PRESS_OVER_x8, .standby = STANDBY_625 },
+	},
+	.pressRise = 0.05f,
+	.pressFall = 0.02f,
+	.tempRise = 0.1f,
+	.tempFall = 0.03f,
+	.spanMs = 1000,
+	.stableSamples = 10,
+};
+
+/**
+ * @brief Pasa al nivel más rápido.
+ *
+ * @param rate Controlador.
+ * @return true si el nivel cambió.
+ */
+static bool BMP280_Rate_Escalate(bmp280_rate_t *rate)
+{
+	rate->stableCount = 0;
+	if(rate->level == BMP280_RATE_LEVELS - 1u)
+		return false;
+
+	rate->level = BMP280_RATE_LEVELS - 1u;
+	rate->escalations++;
+
+	return true;
+}
+
+bmp280_status_t BMP280_Rate_Init(bmp280_rate_t *rate, const bmp280_rate_policy_t *policy)
+{
+	if(rate == NULL)
+		return BMP280_ERROR_PARAM;
+
+	if(policy == NULL)
+		policy = &BMP280_Rate_Default_Policy;
+
+	if(policy->spanMs == 0 || policy->stableSamples == 0 ||
+	   !(policy->pressFall <= policy->pressRise) || !(policy->tempFall <= policy->tempRise))
+		return BMP280_ERROR_PARAM;
+
+	for(uint8_t i = 0; i < BMP280_RATE_LEVELS; i++)
+	{
+		if(policy->levels[i].periodMs == 0)
+			return BMP280_ERROR_PARAM;
+	}
+
+	*rate = (bmp280_rate_t){0};
+	rate->policy = policy;
+
+	return BMP280_OK;
+}
+
+bool BMP280_Rate_Update(bmp280_rate_t *rate, const bmp280_sample_t *sample)
+{
+	const bmp280_rate_policy_t *policy;
+	uint32_t elapsedMs;
+	float deltaPress, deltaTemp, spanS;
+
+	if(rate == NULL || rate->policy == NULL || sample == NULL)
+		return false;
+
+	policy = rate->policy;
+	rate->samples++;
+	rate->levelSamples[rate->level]++;
+
+	if(!rate->primed)
+	{
+		rate->primed = true;
+		rate->refTick = sample->timestamp;
+		rate->refPress = sample->pressure;
+		rate->refTemp = sample->temperature;
+		return false;
+	}
+
+	elapsedMs = sample->timestamp - rate->refTick;
+	deltaPress = fabsf(sample->pressure - rate->refPress);
+	deltaTemp = fabsf(sample->temperature - rate->refTemp);
+	spanS = policy->spanMs / 1000.0f;
+
+	/* Un salto que ya supera lo admitido en todo el intervalo se atiende sin esperar a completarlo */
+	if(elapsedMs < policy->spanMs)
+	{
+		if(deltaPress <= policy->pressRise * spanS && deltaTemp <= policy->tempRise * spanS)
+			return false;
+		elapsedMs = policy->spanMs;
+	}
+
+	rate->pressRate = deltaPress * 1000.0f / elapsedMs;
+	rate->tempRate = deltaTemp * 1000.0f / elapsedMs;
+	rate->refTick = sample->timestamp;
+	rate->refPress = sample->pressure;
+	rate->refTemp = sample->temperature;
+
+	if(rate->pressRate > policy->pressRise || rate->tempRate > policy->tempRise)
+		return BMP280_Rate_Escalate(rate);
+
+	if(rate->pressRate >= policy->pressFall || rate->tempRate >= policy->tempFall)
+	{
+		rate->stableCount = 0;			/* Entre umbrales: se mantiene el nivel */
+		return false;
+	}
+
+	if(++rate->stableCount < policy->stableSamples || rate->level == 0)
+		return false;
+
+	rate->stableCount = 0;
+	rate->level--;
+	rate->relaxations++;
+
+	return true;
+}
+
+bmp280_status_t BMP280_Rate_Apply(const bmp280_rate_t *rate, bmp280_t *dev)
+{
+	const bmp280_rate_level_t *level;
+	bmp280_config_t cfg;
+
+	if(rate == NULL || rate->policy == NULL || dev == NULL)
+		return BMP280_ERROR_PARAM;
+
+	level = &rate->policy->levels[rate->level];
+	BMP280_Get_Config(dev, &cfg);
+	cfg.osrsT = level->osrsT;
+	cfg.osrsP = level->osrsP;
+	if(cfg.mode == NORMAL_MODE)
+		cfg.standby = level->standby;
+
+	return BMP280_Set_Config(dev, &cfg);
+}
+
+const bmp280_rate_level_t *BMP280_Rate_Get_Level(const bmp280_rate_t *rate)
+{
+	return &rate->policy->levels[rate->level];
+}
@@ -0,0 +1,98 @@
+/**
+ * @file BMP280_ring.c
+ * @author Ing. Lucas Kirschner
+ * @date 15 Oct 2026
+ * @brief Implementación del buffer circular de muestras sin bloqueos.
+ *
+ * `head` cuenta las muestras agregadas y cada lector guarda su propio `tail`; las diferencias
+ * en aritmética sin signo de 32 bits son correctas aun cuando los contadores se desbordan.
+ * El productor escribe la ranura y recién después publica `head` con semántica release; el
+ * lector copia la ranura y vuelve a leer `head` para detectar si fue sobrescrita mientras tanto.
+ */
+
+#include <stddef.h>
+
+#include "BMP280_ring.h"
+
+#define RING_MASK		(BMP280_RING_SIZE - 1u)
+#define RING_DEPTH		(BMP280_RING_SIZE - 1u)	/* La ranura siguiente a `head` puede estar escribiéndose */
+
+_Static_assert((BMP280_RING_SIZE & RING_MASK) == 0, "BMP280_RING_SIZE debe ser potencia de dos");
+
+static uint32_t Ring_Head(const bmp280_ring_t *ring)
+{
+	return __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+}
+
+void BMP280_Ring_Init(bmp280_ring_t *ring)
+{
+	if(ring == NULL)
+		return;
+
+	__atomic_store_n(&ring->head, 0, __ATOMIC_RELEASE);
+}
+
+void BMP280_Ring_Push(bmp280_ring_t *ring, const bmp280_sample_t *sample)
+{
+	if(ring == NULL || sample == NULL)
+		return;
+
+	uint32_t head = ring->head;				/* Único productor: no hace falta sincronizar */
+
+	ring->slots[head & RING_MASK] = *sample;
+	__atomic_store_n(&ring->head, head + 1u, __ATOMIC_RELEASE);
+}
+
+void BMP280_Ring_Reader_Init(const bmp280_ring_t *ring, bmp280_ring_reader_t *reader)
+{
+	if(ring == NULL || reader == NULL)
+		return;
+
+	reader->tail = Ring_Head(ring);
+	reader->overruns = 0;
+}
+
+uint32_t BMP280_Ring_Available(const bmp280_ring_t *ring, const bmp280_ring_reader_t *reader)
+{
+	if(ring == NULL || reader == NULL)
+		return 0;
+
+	uint32_t pending = Ring_Head(ring) - reader->tail;
+
+	return (pending > RING_DEPTH) ? RING_DEPTH : pending;
+}
+
+bool BMP280_Ring_Pop(const bmp280_ring_t *ring, bmp280_ring_reader_t *reader, bmp280_sample_t *sample)
+{
+	if(ring == NULL || reader == NULL || sample == NULL)
+		return false;
+
+	for(;;)
+	{
+		uint32_t head = Ring_Head(ring);
+
+		if(head == reader->tail)
+			return false;
+
+		/* Las muestras más viejas que la profundidad ya fueron (o están siendo) sobrescritas */
+		if(head - reader->tail > RING_DEPTH)
+		{
+			reader->overruns += head - reader->tail - RING_DEPTH;
+			reader->tail = head - RING_DEPTH;
+		}
+
+		*sample = ring->slots[reader->tail & RING_MASK];
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);	/* La copia termina antes de releer `head` */
+
+		/* El productor escribe la ranura de `tail` mientras `head` vale tail + SIZE:
+		 * si se alcanzó ese valor durante la copia, la muestra puede estar mezclada */
+		if(Ring_Head(ring) - reader->tail < BMP280_RING_SIZE)
+		{
+			reader->tail++;
+			return true;
+		}
+
+		reader->overruns++;
+		reader->tail++;
+	}
+}
@@ -0,0 +1,61 @@
+/**
+ * @file BMP280_test_host.c
+ * @author Ing. Lucas Kirschner
+ * @date 16 Oct 2026
+ * @brief Programa de prueba en host: compensación contra el vector de referencia y exactitud de la altitud.
+ *
+ * Sólo se compila con `BMP280_TEST_HOST` (y `BMP280_BENCHMARK`), por lo que no aporta nada a la
+ * imagen del micro. Ejecuta ::BMP280_Benchmark_Compensation, que verifica la compensación entera
+ * contra el vector de referencia (T = 2508, P = 25767233) y las variantes en punto flotante contra
+ * ella. Después ejecuta ::ALTITUDE_Benchmark, que compara la altitud de 300 a 1100 hPa contra la
+ * fórmula exacta en doble precisión y falla si el error supera ALTITUDE_ERROR_BOUND_M. Termina con
+ * un código distinto de cero si algo no coincide. El transporte es el de reproducción, que no
+ * necesita ninguna captura cargada para esta prueba:
+ *
+ *   gcc -O2 -DBMP280_TEST_HOST -DBMP280_BENCHMARK -DBENCH_HOST -DBMP280_PORT_REPLAY -DNVM_HOST
+ *       -DBMP280_PRINT_SAMPLES=0 -ICore/API/BMP280/Inc -ICore/API/NVM/Inc -ICore/API/SWO/Inc
+ *       -ICore/API/BENCH/Inc -ICore/API/ALTITUDE/Inc Core/API/BMP280/Src/BMP280.c
+ *       Core/API/BMP280/Src/BMP280_cache.c Core/API/ALTITUDE/Src/ALTITUDE.c
+ *       Core/API/BMP280/Src/BMP280_ring.c Core/API/BMP280/Src/BMP280_capture.c
+ *       Core/API/BMP280/Src/BMP280_port_replay.c Core/API/BMP280/Src/BMP280_bus.c
+ *       Core/API/NVM/Src/NVM.c Core/API/BENCH/Src/BENCH.c Core/API/BMP280/Src/BMP280_test_host.c
+ *       -lm -o bmp280_test && ./bmp280_test
+ */
+
+#ifdef BMP280_TEST_HOST
+
+#ifndef BMP280_BENCHMARK
+#error "BMP280_TEST_HOST necesita BMP280_BENCHMARK"
+#endif
+
+#include <stdio.h>
+
+#include "ALTITUDE.h"
+#include "BMP280.h"
+
+#define TEST_ITERATIONS		10000u	/**< Iteraciones de la medición de tiempos, que aquí es secundaria */
+
+int main(void)
+{
+	bmp280_status_t status;
+	altitude_status_t altStatus;
+
+	status = BMP280_Benchmark_Compensation(TEST_ITERATIONS);
+	if(status != BMP280_OK)
+	{
+		printf("FAIL: compensation (status %d)\n", (int)status);
+		return 1;
+	}
+
+	altStatus = ALTITUDE_Benchmark(TEST_ITERATIONS);
+	if(altStatus != ALTITUDE_OK)
+	{
+		printf("FAIL: altitude (status %d)\n", (int)altStatus);
+		return 1;
+	}
+
+	printf("PASS\n");
+	return 0;
+}
+
+#endif /* BMP280_TEST_HOST */
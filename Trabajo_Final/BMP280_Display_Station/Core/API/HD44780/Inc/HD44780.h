@@ -14,8 +14,10 @@
 
 #include "HD44780_port.h"
 
-#define ROW_NUMBERS		2
-#define COLUMN_NUMBERS	16
+#define ROW_NUMBERS		2			/**< Filas del display (hasta 4) */
+#define COLUMN_NUMBERS	16			/**< Columnas del display */
+
+#define HD44780_MERGE_GAP	1		/**< Celdas sin cambios que ::HD44780_Flush reescribe para no enviar otra dirección */
 
 /**
  * @defgroup HD44780_IR_Instructions Instrucciones IR del HD44780
@@ -140,8 +142,21 @@ typedef enum
 	HD44780_OK = 0,                 /**< Operación exitosa */
 	HD44780_ERROR_PARAM,            /**< Error en el parámetro pasado como argumento */
 	HD44780_ERROR_COMM,             /**< Error de comunicación con el display */
+	HD44780_BUSY,                   /**< Volcado asíncrono en curso; reintentar al terminar */
 } hd44780_status_t;
 
+/**
+ * @brief Contadores de tráfico hacia el display.
+ */
+typedef struct
+{
+	uint32_t dataBytes;            /**< Caracteres escritos en DDRAM */
+	uint32_t commands;             /**< Instrucciones enviadas (incluye las de dirección) */
+	uint32_t addressCommands;      /**< Instrucciones de dirección de DDRAM */
+	uint32_t flushes;              /**< Llamadas a ::HD44780_Flush */
+	hd44780_port_stats_t bus;      /**< Transferencias, bytes y tiempo en el bus I2C */
+} hd44780_stats_t;
+
 /**
  * @brief Inicializa el controlador LCD HD44780.
  *
@@ -158,11 +173,14 @@ hd44780_status_t HD44780_Init(void);
 /**
  * @brief Escribe una cadena de caracteres en el display.
  *
+ * La cadena va en una sola transferencia I2C, o en bloques de HD44780_PORT_BATCH_CHARS si es más larga.
+ *
  * @param dataWrite Puntero a la cadena a enviar.
  *
  * @retval HD44780_OK            Escritura exitosa.
  * @retval HD44780_ERROR_PARAM   El puntero a la cadena es NULL.
  * @retval HD44780_ERROR_COMM    Error de comunicación con el display.
+ * @retval HD44780_BUSY          Hay un volcado asíncrono en curso.
  */
 hd44780_status_t HD44780_Write(uint8_t *dataWrite);
 
@@ -171,6 +189,7 @@ hd44780_status_t HD44780_Write(uint8_t *dataWrite);
  *
  * @retval HD44780_OK           Limpieza exitosa.
  * @retval HD44780_ERROR_COMM   Error de comunicación con el display.
+ * @retval HD44780_BUSY         Hay un volcado asíncrono en curso.
  */
 hd44780_status_t HD44780_Clear(void);
 
@@ -183,6 +202,7 @@ hd44780_status_t HD44780_Clear(void);
  * @retval HD44780_OK            Posicionamiento exitoso.
  * @retval HD44780_ERROR_PARAM   Parámetro de fila o columna fuera de rango.
  * @retval HD44780_ERROR_COMM    Error de comunicación con el display.
+ * @retval HD44780_BUSY          Hay un volcado asíncrono en curso.
  */
 hd44780_status_t HD44780_Set_Cursor(uint8_t row, uint8_t column);
 
@@ -193,7 +213,102 @@ hd44780_status_t HD44780_Set_Cursor(uint8_t row, uint8_t column);
  *
  * @retval HD44780_OK           Escritura exitosa.
  * @retval HD44780_ERROR_COMM   Error de comunicación con el display.
+ * @retval HD44780_BUSY         Hay un volcado asíncrono en curso.
  */
 hd44780_status_t HD44780_Write_int(int16_t value);
 
+/**
+ * @brief Llena el framebuffer con espacios, sin comunicarse con el display.
+ *
+ * El driver guarda en RAM el contenido pedido para cada celda (framebuffer) y una copia de lo que
+ * tiene la DDRAM del controlador; las funciones HD44780_Fb_* sólo modifican el primero y
+ * ::HD44780_Flush envía las diferencias. Borrar y volver a escribir toda la pantalla en cada
+ * refresco no genera tráfico por las celdas que no cambiaron.
+ */
+void HD44780_Fb_Clear(void);
+
+/**
+ * @brief Escribe una cadena en el framebuffer, recortada al final de la fila.
+ *
+ * @param row    Fila (1 ... ROW_NUMBERS).
+ * @param column Columna inicial (1 ... COLUMN_NUMBERS).
+ * @param text   Cadena terminada en nulo.
+ *
+ * @retval HD44780_OK            Escritura exitosa.
+ * @retval HD44780_ERROR_PARAM   Posición fuera de rango o puntero nulo.
+ */
+hd44780_status_t HD44780_Fb_Write(uint8_t row, uint8_t column, const uint8_t *text);
+
+/**
+ * @brief Envía al display sólo las celdas del framebuffer que difieren de su DDRAM.
+ *
+ * Recorre cada fila buscando tramos de celdas modificadas; dos tramos separados por hasta
+ * HD44780_MERGE_GAP celdas iguales se envían como uno solo (reescribir una celda cuesta lo mismo
+ * que una instrucción de dirección). La dirección de DDRAM sólo se envía cuando el contador de
+ * direcciones del controlador, que avanza solo con cada carácter, no está ya en el inicio del tramo.
+ *
+ * @retval HD44780_OK           Display actualizado (o sin cambios).
+ * @retval HD44780_BUSY         Hay un volcado asíncrono en curso.
+ * @retval HD44780_ERROR_COMM   Error de comunicación; el próximo volcado reenvía toda la pantalla.
+ */
+hd44780_status_t HD44780_Flush(void);
+
+/**
+ * @brief Como ::HD44780_Flush, pero entrega las diferencias al DMA del I2C y retorna sin esperar.
+ *
+ * A 100 kHz cada carácter ocupa unos 360 µs de bus, de modo que una pantalla completa de 16x2
+ * bloquearía el lazo principal más de 12 ms. Con esta función sólo se arma el lote; el
+ * framebuffer puede volver a modificarse enseguida, porque la transferencia usa un buffer propio
+ * del puerto. Al terminar se invoca ::HD44780_Flush_Complete_Callback; mientras tanto
+ * ::HD44780_Is_Busy devuelve true y las demás funciones de escritura devuelven HD44780_BUSY.
+ *
+ * @retval HD44780_OK           Transferencia iniciada (o display sin cambios).
+ * @retval HD44780_BUSY         El volcado anterior sigue en curso o el bus está ocupado; el
+ *                              framebuffer queda pendiente.
+ * @retval HD44780_ERROR_COMM   No se pudo iniciar la transferencia.
+ */
+hd44780_status_t HD44780_Flush_Async(void);
+
+/**
+ * @brief Indica si hay un volcado asíncrono en curso.
+ *
+ * @return true hasta que termine la transferencia iniciada por ::HD44780_Flush_Async.
+ */
+bool HD44780_Is_Busy(void);
+
+/**
+ * @brief Notificación de fin de un volcado iniciado con ::HD44780_Flush_Async.
+ *
+ * Se ejecuta en contexto de interrupción. El driver provee una implementación débil vacía;
+ * la aplicación puede redefinirla. Ante un error, el próximo volcado reenvía toda la pantalla.
+ *
+ * @param status HD44780_OK o HD44780_ERROR_COMM.
+ */
+void HD44780_Flush_Complete_Callback(hd44780_status_t status);
+
+/**
+ * @brief Copia los contadores de tráfico.
+ *
+ * @param out Estructura destino.
+ */
+void HD44780_Get_Stats(hd44780_stats_t *out);
+
+#ifdef BMP280_BENCHMARK
+/**
+ * @brief Mide el tiempo de redibujar la pantalla completa y de actualizar una sola celda.
+ *
+ * Inicializa el display y mide un clear seguido de otra instrucción, que con busy flag termina
+ * en el tiempo real del controlador. Luego vuelca un patrón que cambia las ROW_NUMBERS x
+ * COLUMN_NUMBERS celdas y cambia una sola, e imprime por SWO los ticks y microsegundos de cada
+ * ::HD44780_Flush, junto con las transferencias, los bytes en el bus I2C y el tiempo de
+ * transferencia de cada uno. Por último redibuja la pantalla con ::HD44780_Flush_Async e imprime
+ * cuánto bloquea el lazo frente a lo que dura la transferencia por DMA. Al terminar deja la
+ * pantalla en blanco. Se compila con el mismo flag que el benchmark de compensación del BMP280.
+ *
+ * @retval HD44780_OK           Medición completa.
+ * @retval HD44780_ERROR_COMM   Error de comunicación con el display.
+ */
+hd44780_status_t HD44780_Benchmark_Redraw(void);
+#endif
+
 #endif /* HD44780_INC_HD44780_H_ */
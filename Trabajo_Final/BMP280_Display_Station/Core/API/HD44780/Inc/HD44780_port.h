@@ -20,6 +20,12 @@
  */
 #define DEV_ADDRESS 0x27
 
+#ifndef HD44780_USE_BUSY_FLAG
+#define HD44780_USE_BUSY_FLAG		1	/**< 1: esperas por lectura del busy flag si RW está cableado (ver ::HD44780_Port_Probe_Busy_Flag) */
+#endif
+
+#define HD44780_PORT_BATCH_CHARS	84	/**< Bytes del HD44780 por transferencia: un display de 4x20 con la dirección de cada fila */
+
 /**
  * @brief Códigos de estado para las operaciones del puerto PCF8574.
  */
@@ -27,8 +33,22 @@ typedef enum
 {
     HD44780_PORT_OK = 0,      /**< Operación exitosa */
 	HD44780_PORT_ERROR,       /**< Error en la comunicación */
+	HD44780_PORT_BUSY,        /**< Transferencia por DMA en curso */
 } hd44780_port_status_t;
 
+/**
+ * @brief Contadores del bus I2C.
+ */
+typedef struct
+{
+	uint32_t transfers;            /**< Transferencias I2C (start, dirección, datos, stop) */
+	uint32_t wireBytes;            /**< Bytes en el bus, incluido el de dirección de cada transferencia */
+	uint32_t busyUs;               /**< Tiempo dentro de HAL_I2C_Master_Transmit, en microsegundos */
+	uint32_t asyncUs;              /**< Duración de las transferencias por DMA, en microsegundos */
+	uint32_t busyPolls;            /**< Lecturas del busy flag */
+	uint32_t busyEarly;            /**< Esperas terminadas por BF antes de la reserva de peor caso */
+} hd44780_port_stats_t;
+
 /**
  * @brief Inicializa la interfaz usada por el HD44780.
  *
@@ -44,6 +64,17 @@ hd44780_port_status_t HD44780_Port_Init(void);
  */
 void HD44780_Port_Delay(uint32_t delay);
 
+/**
+ * @brief Reserva el tiempo de ejecución de la instrucción recién enviada.
+ *
+ * No bloquea: el próximo nibble espera, con resolución de microsegundos (contador de ciclos
+ * DWT), sólo lo que falte de `us` desde esta llamada. Como una escritura I2C ya dura más que
+ * la mayoría de las instrucciones, en general no se espera nada.
+ *
+ * @param us Tiempo mínimo hasta la próxima escritura, en microsegundos.
+ */
+void HD44780_Port_Hold_Us(uint32_t us);
+
 /**
  * @brief Envía un nibble (4 bits) al LCD HD44780.
  *
@@ -72,4 +103,95 @@ hd44780_port_status_t HD44780_Port_Send_Nibble(uint8_t nibbleWrite, bool rs);
  */
 hd44780_port_status_t HD44780_Port_Send_Byte(uint8_t byteWrite, bool rs);
 
+/**
+ * @brief Empieza un lote de bytes a enviar en una sola transferencia I2C.
+ *
+ * El PCF8574 actualiza sus salidas con cada byte de una escritura de varios bytes, así que los
+ * cuatro estados de cada byte del HD44780 (nibble alto con EN en alto y en bajo, ídem el nibble
+ * bajo) pueden ir seguidos en un mismo buffer. Se ahorran el start, la dirección y el stop de
+ * cada uno de los 4 bytes que ::HD44780_Port_Send_Byte transmite por separado.
+ */
+void HD44780_Port_Batch_Begin(void);
+
+/**
+ * @brief Agrega un byte al lote.
+ *
+ * Entre el último flanco de un byte y el primero del siguiente pasa un tiempo de byte en el
+ * bus (90 µs a 100 kHz), más que los 37-41 µs de las instrucciones y escrituras comunes, que
+ * entonces se encadenan sin esperas. Si `execUs` del byte anterior lo supera (clear, return
+ * home o un bus más rápido), o si el buffer se llena, lo encolado se envía antes y se respeta
+ * la reserva como en el envío byte a byte.
+ *
+ * @param byteWrite Byte a escribir.
+ * @param rs        true: registro de datos; false: registro de instrucción.
+ * @param execUs    Tiempo de ejecución del byte en el HD44780, en microsegundos.
+ */
+void HD44780_Port_Batch_Add(uint8_t byteWrite, bool rs, uint32_t execUs);
+
+/**
+ * @brief Envía lo que quede del lote y reserva el tiempo de ejecución del último byte.
+ *
+ * @retval HD44780_PORT_OK    Todas las transferencias del lote fueron exitosas.
+ * @retval HD44780_PORT_BUSY  Había una transferencia por DMA en curso; no se envió nada.
+ * @retval HD44780_PORT_ERROR Falló alguna; el estado del display es desconocido.
+ */
+hd44780_port_status_t HD44780_Port_Batch_End(void);
+
+/**
+ * @brief Inicia por DMA la transferencia de lo que quede del lote y retorna sin esperarla.
+ *
+ * El buffer del lote queda en uso hasta el fin de la transferencia, que se notifica con
+ * ::HD44780_Port_Transfer_Complete_Callback; el tiempo de ejecución del último byte se reserva
+ * en ese momento. Mientras tanto, el resto de las funciones de envío devuelven HD44780_PORT_BUSY.
+ * Si el lote ya tuvo que enviarse en partes (ver ::HD44780_Port_Batch_Add), esas partes salieron
+ * de forma bloqueante.
+ *
+ * @retval HD44780_PORT_OK    Transferencia iniciada, o lote vacío.
+ * @retval HD44780_PORT_BUSY  Ya había una transferencia por DMA en curso, o el I2C1 lo tiene un
+ *                           sensor (ver I2C_BUS.h); no se envió nada.
+ * @retval HD44780_PORT_ERROR Falló una parte bloqueante o el inicio del DMA.
+ */
+hd44780_port_status_t HD44780_Port_Batch_End_Async(void);
+
+/**
+ * @brief Indica si hay una transferencia por DMA en curso.
+ *
+ * @return true hasta que finalice la transferencia iniciada por ::HD44780_Port_Batch_End_Async.
+ */
+bool HD44780_Port_Is_Busy(void);
+
+/**
+ * @brief Notificación de fin de una transferencia iniciada con ::HD44780_Port_Batch_End_Async.
+ *
+ * Se ejecuta en contexto de interrupción, con el bus ya liberado. El puerto provee una
+ * implementación débil vacía; el driver la redefine para registrar el resultado.
+ *
+ * @param status HD44780_PORT_OK si la transferencia fue exitosa, HD44780_PORT_ERROR si no.
+ */
+void HD44780_Port_Transfer_Complete_Callback(hd44780_port_status_t status);
+
+/**
+ * @brief Verifica que el busy flag pueda leerse y, si es así, lo habilita para las esperas.
+ *
+ * Con HD44780_USE_BUSY_FLAG, las esperas de más de una consulta (unos 800 µs a 100 kHz, en la
+ * práctica clear y return home) se cortan en cuanto el controlador baja BF; las de 37-41 µs
+ * siguen siendo reservas fijas, porque leer BF tarda más que esperarlas. Requiere que RW del
+ * display esté conectado a P1 del PCF8574: en los módulos con RW a masa la lectura devuelve
+ * BF en 1 con el controlador libre y se siguen usando las reservas fijas.
+ *
+ * Debe llamarse con la interfaz ya en 4 bits (BF no se puede leer antes) y antes de un clear:
+ * si RW está a masa, el ciclo de lectura escribe 0xFF como instrucción (Set DDRAM address 0x7F).
+ * ::HD44780_Port_Init vuelve a deshabilitar el busy flag.
+ *
+ * @return true si las esperas usarán el busy flag.
+ */
+bool HD44780_Port_Probe_Busy_Flag(void);
+
+/**
+ * @brief Copia los contadores del bus I2C.
+ *
+ * @param out Estructura destino.
+ */
+void HD44780_Port_Get_Stats(hd44780_port_stats_t *out);
+
 #endif /* HD44780_INC_HD44780_PORT_H_ */
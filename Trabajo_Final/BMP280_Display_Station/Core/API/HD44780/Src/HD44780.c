@@ -11,15 +11,166 @@
 
 #include "HD44780.h"
 #include <stdio.h>
+#include <string.h>
 
 
-/* Retardos de ejecución de operaciones */
-#define DELAY_TIME_1MS		1				/* Delay de  1ms */
-#define DELAY_TIME_2MS		2				/* Delay de  2ms */
-#define DELAY_TIME_10MS		10				/* Delay de 10ms */
+/* Retardo de encendido, la única espera bloqueante en milisegundos */
 #define DELAY_TIME_40MS		40				/* Delay de 40ms */
 
+/* Tiempos de ejecución de la hoja de datos (tabla 6, f_osc = 270 kHz), en microsegundos */
+#define EXEC_TIME_US		37				/* Instrucciones en general */
+#define EXEC_TIME_DATA_US	41				/* Escritura en DDRAM: 37 µs + t_ADD */
+#define EXEC_TIME_HOME_US	1520			/* Return home */
+#define EXEC_TIME_CLEAR_US	2000			/* Clear display (sin valor en la tabla; se usa un margen sobre return home) */
+#define INIT_WAIT_FIRST_US	4100			/* Tras el primer Function Set de 8 bits */
+#define INIT_WAIT_US		100				/* Tras los siguientes */
 
+/* Direcciones de DDRAM en modo 2 líneas: 0x00 ... 0x27 y 0x40 ... 0x67 */
+#define DDRAM_LINE1_END		0x27
+#define DDRAM_LINE2_START	0x40
+#define DDRAM_LINE2_END		0x67
+#define DDRAM_UNKNOWN		0xFF			/* Contador de direcciones desconocido */
+
+#if ROW_NUMBERS < 1 || ROW_NUMBERS > 4
+#error "ROW_NUMBERS debe estar entre 1 y 4"
+#endif
+
+/* Dirección de DDRAM de la primera columna de cada fila: en los displays de 4 filas, la 3 y la 4
+ * continúan a la 1 y la 2 (0x14 y 0x54 en un 20x4, 0x10 y 0x50 en un 16x4) */
+static const uint8_t rowAddress[4] = { 0x00, 0x40, 0x00 + COLUMN_NUMBERS, 0x40 + COLUMN_NUMBERS };
+
+static uint8_t frame[ROW_NUMBERS][COLUMN_NUMBERS];	/* Contenido pedido para cada celda */
+static uint8_t ddram[ROW_NUMBERS][COLUMN_NUMBERS];	/* Copia de lo que tiene el controlador */
+static bool ddramValid;								/* false: la copia no es confiable (error de bus) */
+static bool frameReady;								/* El framebuffer ya fue inicializado */
+static uint8_t cursorAddress = DDRAM_UNKNOWN;		/* Contador de direcciones del controlador */
+static volatile bool asyncFailed;					/* Falló el último volcado asíncrono */
+static hd44780_stats_t stats;
+
+/**
+ * @brief Avanza la copia del contador de direcciones como lo hace el controlador tras escribir un dato.
+ */
+static void HD44780_Advance_Cursor(void)
+{
+	if(cursorAddress == DDRAM_UNKNOWN)
+		return;
+
+	if(cursorAddress == DDRAM_LINE1_END)
+		cursorAddress = DDRAM_LINE2_START;
+	else if(cursorAddress == DDRAM_LINE2_END)
+		cursorAddress = 0x00;
+	else
+		cursorAddress++;
+}
+
+/**
+ * @brief Envía una instrucción y la cuenta.
+ */
+static hd44780_status_t HD44780_Command(uint8_t command)
+{
+	stats.commands++;
+	if(HD44780_Port_Send_Byte(command, false) != HD44780_PORT_OK)
+	{
+		ddramValid = false;
+		cursorAddress = DDRAM_UNKNOWN;
+		return HD44780_ERROR_COMM;
+	}
+
+	/* Sólo clear y return home son lentas; las demás terminan antes de la próxima escritura I2C */
+	if(command == IR_CLEAR_DISPLAY)
+		HD44780_Port_Hold_Us(EXEC_TIME_CLEAR_US);
+	else if((command & 0xFE) == IR_RETURN_HOME)
+		HD44780_Port_Hold_Us(EXEC_TIME_HOME_US);
+	else
+		HD44780_Port_Hold_Us(EXEC_TIME_US);
+
+	return HD44780_OK;
+}
+
+/**
+ * @brief Actualiza la copia de la DDRAM tras escribir un carácter en la dirección actual.
+ */
+static void HD44780_Track_Data(uint8_t character)
+{
+	/* Sólo las celdas visibles tienen copia */
+	for(uint8_t row = 0; row < ROW_NUMBERS && cursorAddress != DDRAM_UNKNOWN; row++)
+	{
+		if(cursorAddress >= rowAddress[row] && cursorAddress < rowAddress[row] + COLUMN_NUMBERS)
+			ddram[row][cursorAddress - rowAddress[row]] = character;
+	}
+	HD44780_Advance_Cursor();
+}
+
+/**
+ * @brief Agrega caracteres consecutivos al lote en armado (ver ::HD44780_Port_Batch_Add).
+ *
+ * La copia de la DDRAM se actualiza al encolar; si el envío falla, quien cierra el lote la
+ * invalida con ::HD44780_Invalidate.
+ *
+ * @param address Dirección de DDRAM del primer carácter, que va en el mismo lote, o
+ *                DDRAM_UNKNOWN para escribir desde la dirección actual.
+ * @param text    Caracteres a escribir.
+ * @param count   Cantidad de caracteres.
+ */
+static void HD44780_Queue_Run(uint8_t address, const uint8_t *text, size_t count)
+{
+	if(address != DDRAM_UNKNOWN)
+	{
+		stats.commands++;
+		stats.addressCommands++;
+		HD44780_Port_Batch_Add(IR_SET_DDRAM_ADDR(address), false, EXEC_TIME_US);
+		cursorAddress = address;
+	}
+	for(size_t i = 0; i < count; i++)
+	{
+		stats.dataBytes++;
+		HD44780_Port_Batch_Add(text[i], true, EXEC_TIME_DATA_US);
+		HD44780_Track_Data(text[i]);
+	}
+}
+
+/**
+ * @brief Descarta la copia de la DDRAM tras un error de bus: el próximo volcado reenvía todo.
+ */
+static void HD44780_Invalidate(void)
+{
+	ddramValid = false;
+	cursorAddress = DDRAM_UNKNOWN;
+}
+
+/**
+ * @brief Indica si el display admite una nueva operación y aplica el resultado del último
+ *        volcado asíncrono.
+ *
+ * @return false mientras haya un volcado asíncrono en curso.
+ */
+static bool HD44780_Idle(void)
+{
+	if(HD44780_Port_Is_Busy())
+		return false;
+
+	if(asyncFailed)
+	{
+		asyncFailed = false;
+		HD44780_Invalidate();
+	}
+
+	return true;
+}
+
+/**
+ * @brief Registra que el controlador borró la DDRAM (espacios) y volvió a la dirección 0.
+ */
+static void HD44780_Mark_Cleared(void)
+{
+	for(uint8_t row = 0; row < ROW_NUMBERS; row++)
+	{
+		for(uint8_t column = 0; column < COLUMN_NUMBERS; column++)
+			ddram[row][column] = ' ';
+	}
+	ddramValid = true;
+	cursorAddress = 0x00;
+}
 
 /**
  * @brief Inicializa el controlador LCD HD44780 en modo de 4 bits.
@@ -54,9 +205,17 @@
  */
 hd44780_status_t HD44780_Init(void)
 {
+	/* El framebuffer conserva su contenido entre reinicializaciones; sólo arranca en blanco */
+	if(!frameReady)
+	{
+		HD44780_Fb_Clear();
+		frameReady = true;
+	}
+
 	/* Paso 0: Inicialización del periférico */
 	if(HD44780_Port_Init() != HD44780_PORT_OK)
 		return HD44780_ERROR_COMM;
+	asyncFailed = false;					/* Un volcado asíncrono pendiente quedó abortado */
 
 	/* Paso 1: Espera después de que VCC haya subido (más de 15 ms) */
 	HD44780_Port_Delay(DELAY_TIME_40MS); 				/* Se suele usar 40 ms por seguridad */
@@ -64,40 +223,42 @@ hd44780_status_t HD44780_Init(void)
 	/* Paso 2: Envío de los primeros comandos (modo 8 bits por defecto) */
 	if(HD44780_Port_Send_Nibble(0x03, false) != HD44780_PORT_OK)		/* LCD interpreta como 0x30 (modo 8 bits) */
 		return HD44780_ERROR_COMM;
-	HD44780_Port_Delay(DELAY_TIME_10MS);								/* Espera >4.1 ms */
+	HD44780_Port_Hold_Us(INIT_WAIT_FIRST_US);							/* Espera >4.1 ms */
 
 	if(HD44780_Port_Send_Nibble(0x03, false) != HD44780_PORT_OK)		/* Repetición para reforzar el modo 8 bits */
 		return HD44780_ERROR_COMM;
-	HD44780_Port_Delay(DELAY_TIME_1MS);									/* Espera >100us */
+	HD44780_Port_Hold_Us(INIT_WAIT_US);									/* Espera >100us */
 
 	if(HD44780_Port_Send_Nibble(0x03, false) != HD44780_PORT_OK)		/* Repetición para reforzar el modo 8 bits */
 		return HD44780_ERROR_COMM;
-	HD44780_Port_Delay(DELAY_TIME_1MS);									/* Espera >100us */
+	HD44780_Port_Hold_Us(INIT_WAIT_US);									/* Espera >100us */
 
 	/* Paso 3: Enviar comando 0x20 → Modo de 4 bits */
 	if(HD44780_Port_Send_Nibble(0x02, false) != HD44780_PORT_OK)		/* LCD interpreta como 0x20 (modo 4 bits) */
 		return HD44780_ERROR_COMM;
-	HD44780_Port_Delay(DELAY_TIME_1MS);
+	HD44780_Port_Hold_Us(EXEC_TIME_US);
 
 	/* Paso 4: Configurar el modo de operación (líneas, fuente, etc.) */
-	if(HD44780_Port_Send_Byte(IR_FUNCTION_SET(LCD_INTERFACE_4BIT, LCD_DISPLAY_2LINE, LCD_FONT_5x8), false) != HD44780_PORT_OK)
+	if(HD44780_Command(IR_FUNCTION_SET(LCD_INTERFACE_4BIT, LCD_DISPLAY_2LINE, LCD_FONT_5x8)) != HD44780_OK)
 		return HD44780_ERROR_COMM;
 
 	/* Paso 5: Apagar el display */
-	if(HD44780_Port_Send_Byte(IR_DISPLAY_CONTROL(LCD_DISPLAY_OFF, LCD_CURSOR_OFF, LCD_BLINK_OFF), false) != HD44780_PORT_OK)
+	if(HD44780_Command(IR_DISPLAY_CONTROL(LCD_DISPLAY_OFF, LCD_CURSOR_OFF, LCD_BLINK_OFF)) != HD44780_OK)
 		return HD44780_ERROR_COMM;
 
-	/* Paso 6: Limpiar el display */
-	if(HD44780_Port_Send_Byte(IR_CLEAR_DISPLAY, false) != HD44780_PORT_OK)
+	/* Paso 6: Limpiar el display. Antes se prueba el busy flag (ya se puede leer en 4 bits):
+	   si RW no está cableado, lo que la prueba escriba como instrucción lo borra el clear */
+	HD44780_Port_Probe_Busy_Flag();
+	if(HD44780_Command(IR_CLEAR_DISPLAY) != HD44780_OK)
 		return HD44780_ERROR_COMM;
-	HD44780_Port_Delay(DELAY_TIME_2MS);					/* Esperar al menos 2 ms para que el display se limpie */
+	HD44780_Mark_Cleared();
 
 	/* Paso 7: Encender el display */
-	if(HD44780_Port_Send_Byte(IR_DISPLAY_CONTROL(LCD_DISPLAY_ON, LCD_CURSOR_OFF, LCD_BLINK_OFF), false) != HD44780_PORT_OK)
+	if(HD44780_Command(IR_DISPLAY_CONTROL(LCD_DISPLAY_ON, LCD_CURSOR_OFF, LCD_BLINK_OFF)) != HD44780_OK)
 		return HD44780_ERROR_COMM;
 
 	/* Paso 8: Configurar el modo de entrada (incremento y no desplazamiento) */
-	if(HD44780_Port_Send_Byte(IR_ENTRY_MODE_SET(LCD_ENTRY_INCREMENT, LCD_ENTRY_SHIFT_OFF), false) != HD44780_PORT_OK)
+	if(HD44780_Command(IR_ENTRY_MODE_SET(LCD_ENTRY_INCREMENT, LCD_ENTRY_SHIFT_OFF)) != HD44780_OK)
 		return HD44780_ERROR_COMM;
 
 	return HD44780_OK;
@@ -108,11 +269,15 @@ hd44780_status_t HD44780_Write(uint8_t *dataWrite)
 	if(dataWrite == NULL)
 		return HD44780_ERROR_PARAM;				/* Puntero nulo */
 
-	while (*dataWrite != '\0')
+	if(!HD44780_Idle())
+		return HD44780_BUSY;
+
+	HD44780_Port_Batch_Begin();
+	HD44780_Queue_Run(DDRAM_UNKNOWN, dataWrite, strlen((const char *)dataWrite));
+	if(HD44780_Port_Batch_End() != HD44780_PORT_OK)
 	{
-		if(HD44780_Port_Send_Byte(*dataWrite, true) != HD44780_PORT_OK)
-			return HD44780_ERROR_COMM;
-		dataWrite++;
+		HD44780_Invalidate();
+		return HD44780_ERROR_COMM;
 	}
 
 	return HD44780_OK;
@@ -120,31 +285,30 @@ hd44780_status_t HD44780_Write(uint8_t *dataWrite)
 
 hd44780_status_t HD44780_Clear(void)
 {
-	if(HD44780_Port_Send_Byte(IR_CLEAR_DISPLAY, false) != HD44780_PORT_OK)
+	if(!HD44780_Idle())
+		return HD44780_BUSY;
+
+	if(HD44780_Command(IR_CLEAR_DISPLAY) != HD44780_OK)
 		return HD44780_ERROR_COMM;
-	HD44780_Port_Delay(DELAY_TIME_2MS);			/* Esperar al menos 2 ms para que el display se limpie */
+	HD44780_Mark_Cleared();
 
 	return HD44780_OK;
 }
 
 hd44780_status_t HD44780_Set_Cursor(uint8_t row, uint8_t column)
 {
-    if ((row < 1) || (row > 2) || (column < 1) || (column > 16))
+    if ((row < 1) || (row > ROW_NUMBERS) || (column < 1) || (column > COLUMN_NUMBERS))
         return HD44780_ERROR_PARAM; 			/* Parámetros fuera de rango */
 
-    uint8_t address;
+    if (!HD44780_Idle())
+        return HD44780_BUSY;
 
-    if (row == 1)
-    {
-        address = 0x00 + (column - 1); 			/* Fila 1 empieza en 0x00 */
-    }
-    else
-    {
-        address = 0x40 + (column - 1); 			/* Fila 2 empieza en 0x40 */
-    }
+    uint8_t address = rowAddress[row - 1] + (column - 1);	/* Fila 1 empieza en 0x00, fila 2 en 0x40 */
 
-    if(HD44780_Port_Send_Byte(IR_SET_DDRAM_ADDR(address), false) != HD44780_PORT_OK)
+    stats.addressCommands++;
+    if(HD44780_Command(IR_SET_DDRAM_ADDR(address)) != HD44780_OK)
     	return HD44780_ERROR_COMM;
+    cursorAddress = address;
 
     return HD44780_OK;
 }
@@ -160,3 +324,234 @@ hd44780_status_t HD44780_Write_int(int16_t value)
 
 	return status;
 }
+
+void HD44780_Fb_Clear(void)
+{
+	for(uint8_t row = 0; row < ROW_NUMBERS; row++)
+	{
+		for(uint8_t column = 0; column < COLUMN_NUMBERS; column++)
+			frame[row][column] = ' ';
+	}
+}
+
+hd44780_status_t HD44780_Fb_Write(uint8_t row, uint8_t column, const uint8_t *text)
+{
+	if(text == NULL || row < 1 || row > ROW_NUMBERS || column < 1 || column > COLUMN_NUMBERS)
+		return HD44780_ERROR_PARAM;
+
+	for(uint8_t i = column - 1; i < COLUMN_NUMBERS && *text != '\0'; i++)
+		frame[row - 1][i] = *text++;
+
+	return HD44780_OK;
+}
+
+/**
+ * @brief Indica si una celda del framebuffer difiere de la DDRAM.
+ */
+static bool HD44780_Cell_Dirty(uint8_t row, uint8_t column)
+{
+	return !ddramValid || frame[row][column] != ddram[row][column];
+}
+
+/**
+ * @brief Arma en un lote las celdas del framebuffer que difieren de la DDRAM.
+ */
+static void HD44780_Queue_Frame(void)
+{
+	stats.flushes++;
+	HD44780_Port_Batch_Begin();
+
+	for(uint8_t row = 0; row < ROW_NUMBERS; row++)
+	{
+		uint8_t column = 0;
+
+		while(column < COLUMN_NUMBERS)
+		{
+			uint8_t start, end, address;
+
+			if(!HD44780_Cell_Dirty(row, column))
+			{
+				column++;
+				continue;
+			}
+
+			/* Extiendo el tramo mientras la próxima celda distinta esté a HD44780_MERGE_GAP o menos */
+			start = end = column;
+			for(uint8_t next = end + 1; next < COLUMN_NUMBERS && next <= end + 1 + HD44780_MERGE_GAP; next++)
+			{
+				if(HD44780_Cell_Dirty(row, next))
+					end = next;
+			}
+
+			/* La dirección sólo hace falta si el contador no quedó ya en el inicio del tramo */
+			address = rowAddress[row] + start;
+			if(cursorAddress == address)
+				address = DDRAM_UNKNOWN;
+			HD44780_Queue_Run(address, &frame[row][start], end - start + 1u);
+			column = end + 1u;
+		}
+	}
+
+	/* Con el lote armado, la copia vuelve a ser confiable salvo que el envío falle */
+	ddramValid = true;
+}
+
+hd44780_status_t HD44780_Flush(void)
+{
+	if(!HD44780_Idle())
+		return HD44780_BUSY;
+
+	HD44780_Queue_Frame();
+	if(HD44780_Port_Batch_End() != HD44780_PORT_OK)
+	{
+		HD44780_Invalidate();
+		return HD44780_ERROR_COMM;
+	}
+
+	return HD44780_OK;
+}
+
+hd44780_status_t HD44780_Flush_Async(void)
+{
+	hd44780_port_status_t portStatus;
+
+	if(!HD44780_Idle())
+		return HD44780_BUSY;
+
+	HD44780_Queue_Frame();
+	portStatus = HD44780_Port_Batch_End_Async();
+	if(portStatus != HD44780_PORT_OK)
+	{
+		HD44780_Invalidate();			/* El lote no salió: la copia ya lo daba por escrito */
+		return (portStatus == HD44780_PORT_BUSY) ? HD44780_BUSY : HD44780_ERROR_COMM;
+	}
+
+	return HD44780_OK;
+}
+
+bool HD44780_Is_Busy(void)
+{
+	return HD44780_Port_Is_Busy();
+}
+
+__weak void HD44780_Flush_Complete_Callback(hd44780_status_t status)
+{
+	(void)status;
+}
+
+/**
+ * @brief Registra el fin del volcado iniciado por ::HD44780_Flush_Async.
+ *
+ * Redefine el callback débil del puerto. Se ejecuta en la interrupción del I2C, por lo que
+ * sólo marca el error; la copia de la DDRAM se invalida en la próxima operación.
+ *
+ * @param status Resultado de la transferencia.
+ */
+void HD44780_Port_Transfer_Complete_Callback(hd44780_port_status_t status)
+{
+	if(status != HD44780_PORT_OK)
+		asyncFailed = true;
+
+	HD44780_Flush_Complete_Callback(status == HD44780_PORT_OK ? HD44780_OK : HD44780_ERROR_COMM);
+}
+
+void HD44780_Get_Stats(hd44780_stats_t *out)
+{
+	if(out != NULL)
+	{
+		*out = stats;
+		HD44780_Port_Get_Stats(&out->bus);
+	}
+}
+
+#ifdef BMP280_BENCHMARK
+
+#include "API_swo.h"
+#include "BENCH.h"
+
+/**
+ * @brief Vuelca el framebuffer midiendo el tiempo total y el tráfico en el bus.
+ */
+static hd44780_status_t HD44780_Benchmark_Flush(const char *label)
+{
+	hd44780_port_stats_t before, after;
+	uint32_t start, ticks;
+
+	HD44780_Port_Get_Stats(&before);
+	start = BENCH_Now();
+	if(HD44780_Flush() != HD44780_OK)
+		return HD44780_ERROR_COMM;
+	ticks = BENCH_Elapsed(start);
+	HD44780_Port_Get_Stats(&after);
+
+	printf("LCD %s: %lu ticks (%lu us), %lu transfers, %lu bytes on the wire, %lu us on the bus\r\n", label,
+	       (unsigned long)ticks, (unsigned long)(BENCH_Ticks_To_Ns(ticks) / 1000),
+	       (unsigned long)(after.transfers - before.transfers),
+	       (unsigned long)(after.wireBytes - before.wireBytes),
+	       (unsigned long)(after.busyUs - before.busyUs));
+
+	return HD44780_OK;
+}
+
+hd44780_status_t HD44780_Benchmark_Redraw(void)
+{
+	hd44780_port_stats_t before, after;
+	uint32_t start, ticks;
+
+	/* Antes de inicializar: BENCH_Init pone CYCCNT a cero y acortaría una reserva en curso */
+	BENCH_Init();
+	if(HD44780_Init() != HD44780_OK)
+		return HD44780_ERROR_COMM;
+
+	/* Clear seguido de una instrucción: con busy flag, cuesta lo que tarda el controlador. Las
+	   estadísticas son acumuladas (la inicialización también consulta BF): se informa la diferencia */
+	HD44780_Port_Get_Stats(&before);
+	start = BENCH_Now();
+	if(HD44780_Clear() != HD44780_OK || HD44780_Set_Cursor(1, 1) != HD44780_OK)
+		return HD44780_ERROR_COMM;
+	ticks = BENCH_Elapsed(start);
+	HD44780_Port_Get_Stats(&after);
+	printf("LCD clear + cursor: %lu ticks (%lu us), busy flag %s, %lu polls\r\n",
+	       (unsigned long)ticks, (unsigned long)(BENCH_Ticks_To_Ns(ticks) / 1000),
+	       (after.busyEarly > before.busyEarly) ? "used" : "not used",
+	       (unsigned long)(after.busyPolls - before.busyPolls));
+
+	/* Pantalla completa: todas las celdas distintas de lo que dejó el clear */
+	for(uint8_t row = 0; row < ROW_NUMBERS; row++)
+	{
+		for(uint8_t column = 0; column < COLUMN_NUMBERS; column++)
+			frame[row][column] = (uint8_t)('A' + (row * COLUMN_NUMBERS + column) % 26);
+	}
+	if(HD44780_Benchmark_Flush("full redraw") != HD44780_OK)
+		return HD44780_ERROR_COMM;
+
+	/* Un solo dígito, como en un refresco típico del display */
+	frame[0][COLUMN_NUMBERS / 2] = '0';
+	if(HD44780_Benchmark_Flush("one cell") != HD44780_OK)
+		return HD44780_ERROR_COMM;
+
+	/* Pantalla completa por DMA: el lazo principal sólo paga el armado del lote */
+
+	for(uint8_t row = 0; row < ROW_NUMBERS; row++)
+	{
+		for(uint8_t column = 0; column < COLUMN_NUMBERS; column++)
+			frame[row][column] = (uint8_t)('a' + (row * COLUMN_NUMBERS + column) % 26);
+	}
+	HD44780_Port_Get_Stats(&before);
+	start = BENCH_Now();
+	if(HD44780_Flush_Async() != HD44780_OK)
+		return HD44780_ERROR_COMM;
+	ticks = BENCH_Elapsed(start);
+	while(HD44780_Is_Busy())
+		;
+	HD44780_Port_Get_Stats(&after);
+
+	printf("LCD async redraw: %lu ticks (%lu us) blocked, %lu us on the bus\r\n",
+	       (unsigned long)ticks, (unsigned long)(BENCH_Ticks_To_Ns(ticks) / 1000),
+	       (unsigned long)(after.asyncUs - before.asyncUs));
+
+	HD44780_Fb_Clear();
+	return HD44780_Flush();
+}
+
+#endif /* BMP280_BENCHMARK */
@@ -8,16 +8,25 @@
  * permitiendo el control del display en modo 4 bits mediante software.
  */
 
+#include <stddef.h>
+
 #include "HD44780_port.h"
+#include "I2C_BUS.h"
 
-#define DELAY_TIME_1MS  1  	/**< Tiempo base de retardo en milisegundos (1 ms) */
 #define I2C_TIMEOUT_MS	50	/**< Timeout para las transmisiones I2C */
+#define DMA_IRQ_PRIORITY	6	/**< Prioridad del DMA y del I2C, por debajo de la del SPI del BMP280 */
+#define CYCLES_PER_US	(SystemCoreClock / 1000000u)	/**< Ciclos de HCLK por microsegundo */
+#define I2C_BITS_PER_BYTE	9	/**< 8 bits de datos + ACK */
+#define BYTES_PER_CHAR		4	/**< Nibble alto con EN, sin EN, nibble bajo con EN, sin EN */
+#define BATCH_BUFFER_SIZE	(HD44780_PORT_BATCH_CHARS * BYTES_PER_CHAR)	/**< Bytes del PCF8574 por transferencia */
+#define BF_MASK				(1 << 7)	/**< DB7 (P7) al leer el registro de instrucción: busy flag */
+#define BF_POLL_BYTES		10	/**< Bytes en el bus por consulta: 2 escrituras, 1 lectura y 4 escrituras, con sus direcciones */
 
 /* Máscaras de control */
 #define BL_MASK               (1 << 3)   /**< Bit de control de retroiluminación */
 #define EN_MASK               (1 << 2)   /**< Bit de control ENABLE para latch de datos */
 #define RW_MASK_WRITE         (0 << 1)   /**< RW en 0 → Escritura */
-#define RW_MASK_READ          (1 << 1)   /**< RW en 1 → Lectura (no usado en esta implementación) */
+#define RW_MASK_READ          (1 << 1)   /**< RW en 1 → Lectura del busy flag (HD44780_USE_BUSY_FLAG) */
 #define RS_MASK_IR            (0 << 0)   /**< RS en 0 → Registro de instrucción */
 #define RS_MASK_DATA          (1 << 0)   /**< RS en 1 → Registro de datos */
 
@@ -32,8 +41,221 @@
 
 extern I2C_HandleTypeDef hi2c1; 		 /**< Manejador de la interfaz I2C definida en el proyecto */
 
+DMA_HandleTypeDef hdma_i2c1_tx;
+
+static uint32_t holdStart;				 /**< CYCCNT al reservar el tiempo de ejecución */
+static uint32_t holdCycles;				 /**< Duración de la reserva en ciclos */
+static uint32_t byteTimeUs;				 /**< Duración de un byte en el bus, truncada */
+static bool busyFlagOk;					 /**< La lectura del busy flag fue verificada (::HD44780_Port_Probe_Busy_Flag) */
+
+static uint8_t batchBuffer[BATCH_BUFFER_SIZE];	/**< Estados del PCF8574 a enviar en una transferencia */
+static uint16_t batchLength;			 /**< Bytes encolados */
+static uint32_t batchExecUs;			 /**< Tiempo de ejecución del último byte encolado */
+static hd44780_port_status_t batchStatus; /**< Peor resultado de las transferencias del lote */
+static volatile bool asyncBusy;			 /**< Transferencia por DMA en curso */
+static uint32_t asyncStart;				 /**< CYCCNT al iniciar la transferencia por DMA */
+static hd44780_port_stats_t portStats;
+
+/**
+ * @brief Arma el estado del PCF8574 para un nibble: datos en DB7-DB4, retroiluminación, RW=0 y RS.
+ */
+static uint8_t HD44780_Port_Encode(uint8_t nibble, bool rs, bool enable)
+{
+	uint8_t data;
+
+	data  = (nibble << NIBBLE_SHIFT) & HIGH_NIBBLE_MASK;
+	data |= BL_MASK | RW_MASK_WRITE;
+	data |= (rs ? RS_MASK_DATA : RS_MASK_IR);
+	if(enable)
+		data |= EN_MASK;
+
+	return data;
+}
+
+/**
+ * @brief Escribe bytes al PCF8574 en una transferencia y la contabiliza.
+ *
+ * El expansor actualiza sus salidas con el ACK de cada byte, por lo que cada byte del buffer
+ * es un estado de las líneas del display que dura un tiempo de byte en el bus.
+ */
+static hd44780_port_status_t HD44780_Port_Transmit_Raw(uint8_t *data, uint16_t size)
+{
+	HAL_StatusTypeDef result;
+	uint32_t start;
+
+	start = DWT->CYCCNT;
+	result = HAL_I2C_Master_Transmit(&hi2c1, WRITE_DEV_ADDR, data, size, I2C_TIMEOUT_MS);
+
+	portStats.transfers++;
+	portStats.wireBytes += size + 1u;					/* Más el byte de dirección */
+	portStats.busyUs += (DWT->CYCCNT - start) / CYCLES_PER_US;
+
+	return (result == HAL_OK) ? HD44780_PORT_OK : HD44780_PORT_ERROR;
+}
+
+#if HD44780_USE_BUSY_FLAG
+/**
+ * @brief Lee el busy flag con un ciclo de lectura de 4 bits.
+ *
+ * Con RW=1 y RS=0, el HD44780 pone BF en DB7 mientras EN está en alto. Las salidas del PCF8574
+ * son cuasi bidireccionales: escribiendo 1 en P4-P7 quedan con pull-up débil y el display puede
+ * llevarlas a 0, de modo que una lectura I2C devuelve el estado de DB7-DB4. En modo 4 bits cada
+ * lectura son dos nibbles; el segundo (AC3-AC0) se descarta, pero hace falta su pulso de EN para
+ * que el controlador vuelva a esperar un nibble alto. La consulta termina con RW=0 y EN=0,
+ * de modo que la próxima escritura no cambia RW junto con su primer flanco de EN (t_AS).
+ *
+ * @param busy Destino: true si el controlador sigue ejecutando.
+ * @return HD44780_PORT_OK o HD44780_PORT_ERROR.
+ */
+static hd44780_port_status_t HD44780_Port_Read_Busy(bool *busy)
+{
+	uint8_t idle = HIGH_NIBBLE_MASK | BL_MASK | RW_MASK_READ | RS_MASK_IR;	/* DB7-DB4 como entradas */
+	uint8_t strobe[4] = { idle, idle | EN_MASK, idle, BL_MASK | RW_MASK_WRITE | RS_MASK_IR };
+	uint8_t status;
+	HAL_StatusTypeDef result;
+	uint32_t start;
+
+	/* RW y RS se establecen antes del flanco de subida de EN (t_AS) */
+	if(HD44780_Port_Transmit_Raw(strobe, 2) != HD44780_PORT_OK)
+		return HD44780_PORT_ERROR;
+
+	start = DWT->CYCCNT;
+	result = HAL_I2C_Master_Receive(&hi2c1, READ_DEV_ADDR, &status, 1, I2C_TIMEOUT_MS);
+	portStats.transfers++;
+	portStats.wireBytes += 2u;
+	portStats.busyUs += (DWT->CYCCNT - start) / CYCLES_PER_US;
+	if(result != HAL_OK)
+		return HD44780_PORT_ERROR;
+
+	/* Baja EN del nibble alto, pulso del nibble bajo y, con EN ya en 0, vuelta a RW=0 */
+	strobe[0] = idle;
+	if(HD44780_Port_Transmit_Raw(strobe, 4) != HD44780_PORT_OK)
+		return HD44780_PORT_ERROR;
+
+	*busy = (status & BF_MASK) != 0;
+
+	return HD44780_PORT_OK;
+}
+#endif /* HD44780_USE_BUSY_FLAG */
+
+/**
+ * @brief Espera a que termine la instrucción reservada con ::HD44780_Port_Hold_Us.
+ *
+ * Con el busy flag verificado, mientras falte más de lo que dura una consulta se le pregunta
+ * al controlador si ya terminó, y se sigue apenas BF baja: la instrucción cuesta su tiempo real
+ * y no el peor caso de la hoja de datos. Si la lectura falla, se vuelve a las reservas fijas.
+ * Lo que quede por debajo de una consulta se espera con el contador de ciclos, así que nunca se
+ * espera más que la reserva.
+ *
+ * La resta sin signo contempla el desborde de CYCCNT; tras más de 2^32 ciclos sin escribir,
+ * a lo sumo se espera una reserva de más.
+ */
+static void HD44780_Port_Wait_Ready(void)
+{
+#if HD44780_USE_BUSY_FLAG
+	uint32_t pollCycles = BF_POLL_BYTES * byteTimeUs * CYCLES_PER_US;
+	uint32_t elapsed;
+	bool busy;
+
+	while(busyFlagOk && (elapsed = DWT->CYCCNT - holdStart) < holdCycles && holdCycles - elapsed > pollCycles)
+	{
+		portStats.busyPolls++;
+		if(HD44780_Port_Read_Busy(&busy) != HD44780_PORT_OK)
+		{
+			busyFlagOk = false;							/* Respaldo: reservas de peor caso */
+			break;
+		}
+		if(!busy)
+		{
+			portStats.busyEarly++;
+			holdCycles = 0;
+			return;
+		}
+	}
+#endif
+
+	while(DWT->CYCCNT - holdStart < holdCycles)
+		;
+	holdCycles = 0;
+}
+
+/**
+ * @brief Escribe bytes al PCF8574 cuando termina la instrucción anterior.
+ */
+static hd44780_port_status_t HD44780_Port_Transmit(uint8_t *data, uint16_t size)
+{
+	if(asyncBusy)
+		return HD44780_PORT_BUSY;
+
+	HD44780_Port_Wait_Ready();							/* Instrucción anterior terminada */
+
+	return HD44780_Port_Transmit_Raw(data, size);
+}
+
+/**
+ * @brief Envía lo encolado y reserva el tiempo de ejecución del último byte.
+ */
+static void HD44780_Port_Batch_Transmit(void)
+{
+	if(batchLength == 0)
+		return;
+
+	if(HD44780_Port_Transmit(batchBuffer, batchLength) != HD44780_PORT_OK)
+		batchStatus = HD44780_PORT_ERROR;
+	batchLength = 0;
+
+	/* El último flanco de EN salió con el ACK final: desde ahí corre la instrucción */
+	HD44780_Port_Hold_Us(batchExecUs);
+}
+
+/**
+ * @brief Configura el stream de DMA del I2C1_TX y lo vincula al manejador `hi2c1`.
+ *
+ * I2C1_TX usa DMA1 Stream6 en el canal 1 (Stream0 y Stream5 son del SPI3). La HAL
+ * genera el stop desde la interrupción de eventos del I2C, por lo que también se
+ * habilitan I2C1_EV e I2C1_ER.
+ *
+ * @return HD44780_PORT_OK si la configuración fue exitosa.
+ */
+static hd44780_port_status_t HD44780_Port_DMA_Init(void)
+{
+	__HAL_RCC_DMA1_CLK_ENABLE();
+
+	hdma_i2c1_tx.Instance = DMA1_Stream6;
+	hdma_i2c1_tx.Init.Channel = DMA_CHANNEL_1;
+	hdma_i2c1_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+	hdma_i2c1_tx.Init.PeriphInc = DMA_PINC_DISABLE;
+	hdma_i2c1_tx.Init.MemInc = DMA_MINC_ENABLE;
+	hdma_i2c1_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+	hdma_i2c1_tx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+	hdma_i2c1_tx.Init.Mode = DMA_NORMAL;
+	hdma_i2c1_tx.Init.Priority = DMA_PRIORITY_LOW;
+	hdma_i2c1_tx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+	if (HAL_DMA_Init(&hdma_i2c1_tx) != HAL_OK)
+		return HD44780_PORT_ERROR;
+	__HAL_LINKDMA(&hi2c1, hdmatx, hdma_i2c1_tx);
+
+	HAL_NVIC_SetPriority(DMA1_Stream6_IRQn, DMA_IRQ_PRIORITY, 0);
+	HAL_NVIC_EnableIRQ(DMA1_Stream6_IRQn);
+	HAL_NVIC_SetPriority(I2C1_EV_IRQn, DMA_IRQ_PRIORITY, 0);
+	HAL_NVIC_EnableIRQ(I2C1_EV_IRQn);
+	HAL_NVIC_SetPriority(I2C1_ER_IRQn, DMA_IRQ_PRIORITY, 0);
+	HAL_NVIC_EnableIRQ(I2C1_ER_IRQn);
+
+	return HD44780_PORT_OK;
+}
+
 hd44780_port_status_t HD44780_Port_Init(void)
 {
+	  /* Si quedó una transferencia por DMA en curso (p. ej. tras un error), se aborta */
+	  if (asyncBusy)
+	  {
+		  HAL_DMA_Abort(&hdma_i2c1_tx);
+		  HAL_I2C_DeInit(&hi2c1);
+		  asyncBusy = false;
+		  I2C_BUS_Release(I2C_BUS_DISPLAY);
+	  }
+
 	  hi2c1.Instance = I2C1;
 	  hi2c1.Init.ClockSpeed = 100000;
 	  hi2c1.Init.DutyCycle = I2C_DUTYCYCLE_2;
@@ -48,7 +270,14 @@ hd44780_port_status_t HD44780_Port_Init(void)
 	    return HD44780_PORT_ERROR;
 	  }
 
-	  return HD44780_PORT_OK;
+	  /* Contador de ciclos para las esperas en microsegundos (no se pone a cero: puede estar en uso) */
+	  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	  holdCycles = 0;
+	  busyFlagOk = false;								/* Sin BF hasta configurar la interfaz de 4 bits */
+	  byteTimeUs = I2C_BITS_PER_BYTE * 1000000u / hi2c1.Init.ClockSpeed;
+
+	  return HD44780_Port_DMA_Init();
 }
 
 void HD44780_Port_Delay(uint32_t delay)
@@ -56,6 +285,12 @@ void HD44780_Port_Delay(uint32_t delay)
     HAL_Delay(delay);
 }
 
+void HD44780_Port_Hold_Us(uint32_t us)
+{
+	holdStart = DWT->CYCCNT;
+	holdCycles = us * CYCLES_PER_US;
+}
+
 /**
  * @brief Envía un nibble (4 bits) al display HD44780 mediante la expansión I2C del PCF8574.
  *
@@ -85,33 +320,29 @@ void HD44780_Port_Delay(uint32_t delay)
  *    - EN se coloca en 1 para indicar un flanco activo de habilitación.
  *    - Backlight (BL) se fuerza en 1 para mantener encendida la retroiluminación.
  * 3. Se transmite el byte completo vía I2C al PCF8574.
- * 4. Luego de un pequeño retardo, se baja el bit EN a 0 para generar el flanco de bajada,
- *    lo que "latchea" los datos en el HD44780.
+ * 4. Se baja el bit EN a 0 para generar el flanco de bajada, lo que "latchea" los datos en
+ *    el HD44780.
  *
  * Notas:
  * - El proceso de escritura de un byte completo al LCD requiere el envío de dos nibbles consecutivos:
  *   primero el nibble alto y luego el nibble bajo (ver `HD44780_Port_Send_Byte`).
- * - Se utiliza un pequeño retardo de aproximadamente 1 ms entre las operaciones para cumplir con
- *   los requisitos de tiempo de establecimiento y retención del HD44780.
+ * - No hace falta retardo entre las dos escrituras: a 100 kHz cada una dura unos 200 µs, muy por
+ *   encima del ancho de pulso de EN (PW_EH ≥ 230 ns) y de los tiempos de establecimiento y
+ *   retención (t_DSW ≥ 80 ns, t_H ≥ 10 ns). El tiempo de ejecución de cada instrucción lo reserva
+ *   el driver con ::HD44780_Port_Hold_Us y se respeta antes del primer flanco.
  */
 hd44780_port_status_t HD44780_Port_Send_Nibble(uint8_t nibbleWrite, bool rs)
 {
     uint8_t data;
 
-    /* Preparación del byte a enviar: datos (DB7–DB4) + señales de control */
-    data  = (nibbleWrite << NIBBLE_SHIFT) & HIGH_NIBBLE_MASK;  // Cargar datos en DB7–DB4
-    data |= BL_MASK;                                           // Habilitar retroiluminación
-    data |= EN_MASK;                                           // Pulso de Enable (activo en alto)
-    data |= RW_MASK_WRITE;                                     // Escritura (RW=0)
-    data |= (rs ? RS_MASK_DATA : RS_MASK_IR);                  // RS: dato o instrucción
+    /* Preparación del byte a enviar: datos (DB7–DB4) + señales de control, con Enable en alto */
+    data = HD44780_Port_Encode(nibbleWrite, rs, true);
 
-    if(HAL_I2C_Master_Transmit(&hi2c1, WRITE_DEV_ADDR, &data, sizeof(data), I2C_TIMEOUT_MS) != HAL_OK) return HD44780_PORT_ERROR;
-    HD44780_Port_Delay(DELAY_TIME_1MS);
+    if(HD44780_Port_Transmit(&data, sizeof(data)) != HD44780_PORT_OK) return HD44780_PORT_ERROR;
 
     /* Desactivar Enable (flanco de bajada) */
     data &= ~EN_MASK;
-    if(HAL_I2C_Master_Transmit(&hi2c1, WRITE_DEV_ADDR, &data, sizeof(data), I2C_TIMEOUT_MS) != HAL_OK) return HD44780_PORT_ERROR;
-    HD44780_Port_Delay(DELAY_TIME_1MS);
+    if(HD44780_Port_Transmit(&data, sizeof(data)) != HD44780_PORT_OK) return HD44780_PORT_ERROR;
 
     return HD44780_PORT_OK;
 }
@@ -126,3 +357,150 @@ hd44780_port_status_t HD44780_Port_Send_Byte(uint8_t byteWrite, bool rs)
 
     return HD44780_PORT_OK;
 }
+
+void HD44780_Port_Batch_Begin(void)
+{
+	batchLength = 0;
+	batchExecUs = 0;
+	batchStatus = asyncBusy ? HD44780_PORT_BUSY : HD44780_PORT_OK;
+}
+
+void HD44780_Port_Batch_Add(uint8_t byteWrite, bool rs, uint32_t execUs)
+{
+	uint8_t upperNibble = (byteWrite >> NIBBLE_SHIFT) & LOW_NIBBLE_MASK;
+	uint8_t lowerNibble =  byteWrite &  LOW_NIBBLE_MASK;
+
+	/* El buffer es del DMA hasta que termine la transferencia en curso */
+	if(batchStatus == HD44780_PORT_BUSY)
+		return;
+
+	/* Dentro de una transferencia, el primer flanco de este byte sale un tiempo de byte después
+	   del último del anterior: si la instrucción anterior tarda más, se corta y espera la reserva */
+	if(batchLength + BYTES_PER_CHAR > BATCH_BUFFER_SIZE || (batchLength != 0 && batchExecUs > byteTimeUs))
+		HD44780_Port_Batch_Transmit();
+
+	batchBuffer[batchLength++] = HD44780_Port_Encode(upperNibble, rs, true);
+	batchBuffer[batchLength++] = HD44780_Port_Encode(upperNibble, rs, false);
+	batchBuffer[batchLength++] = HD44780_Port_Encode(lowerNibble, rs, true);
+	batchBuffer[batchLength++] = HD44780_Port_Encode(lowerNibble, rs, false);
+	batchExecUs = execUs;
+}
+
+hd44780_port_status_t HD44780_Port_Batch_End(void)
+{
+	if(batchStatus == HD44780_PORT_BUSY)
+		return HD44780_PORT_BUSY;
+
+	HD44780_Port_Batch_Transmit();
+
+	return batchStatus;
+}
+
+hd44780_port_status_t HD44780_Port_Batch_End_Async(void)
+{
+	if(asyncBusy || batchStatus == HD44780_PORT_BUSY)
+		return HD44780_PORT_BUSY;
+
+	if(batchLength == 0)
+		return batchStatus;
+
+	/* El I2C1 es compartido: si lo tiene un sensor, el lote se descarta y se reintenta luego */
+	if(!I2C_BUS_Acquire(I2C_BUS_DISPLAY))
+	{
+		batchLength = 0;
+		return HD44780_PORT_BUSY;
+	}
+
+	/* Sólo espera lo que falte de la instrucción anterior (decenas de µs, salvo tras un clear) */
+	HD44780_Port_Wait_Ready();
+
+	asyncBusy = true;
+	asyncStart = DWT->CYCCNT;
+	portStats.transfers++;
+	portStats.wireBytes += batchLength + 1u;
+	if(HAL_I2C_Master_Transmit_DMA(&hi2c1, WRITE_DEV_ADDR, batchBuffer, batchLength) != HAL_OK)
+	{
+		asyncBusy = false;
+		I2C_BUS_Release(I2C_BUS_DISPLAY);
+		batchStatus = HD44780_PORT_ERROR;
+	}
+	batchLength = 0;
+
+	return batchStatus;
+}
+
+bool HD44780_Port_Is_Busy(void)
+{
+	return asyncBusy;
+}
+
+bool HD44780_Port_Probe_Busy_Flag(void)
+{
+#if HD44780_USE_BUSY_FLAG
+	bool busy = true;
+
+	busyFlagOk = false;
+	if(asyncBusy)
+		return false;
+
+	HD44780_Port_Wait_Ready();							/* Reserva completa: el controlador está libre */
+
+	/* Libre, BF tiene que leerse en 0; si RW está a masa, DB7 queda en 1 por el pull-up */
+	if(HD44780_Port_Read_Busy(&busy) == HD44780_PORT_OK && !busy)
+		busyFlagOk = true;
+
+	return busyFlagOk;
+#else
+	return false;
+#endif
+}
+
+void HD44780_Port_Get_Stats(hd44780_port_stats_t *out)
+{
+	if(out != NULL)
+		*out = portStats;
+}
+
+__weak void HD44780_Port_Transfer_Complete_Callback(hd44780_port_status_t status)
+{
+	(void)status;
+}
+
+/**
+ * @brief Cierra una transferencia por DMA: libera el bus, reserva el tiempo de ejecución del
+ *        último byte y avisa al driver.
+ */
+static void HD44780_Port_Async_Done(hd44780_port_status_t status)
+{
+	portStats.asyncUs += (DWT->CYCCNT - asyncStart) / CYCLES_PER_US;
+	HD44780_Port_Hold_Us(batchExecUs);
+	asyncBusy = false;
+	I2C_BUS_Release(I2C_BUS_DISPLAY);
+	HD44780_Port_Transfer_Complete_Callback(status);
+}
+
+/**
+ * @brief Callback de la HAL al completar una transmisión I2C por DMA (tras el stop).
+ *
+ * @param hi2c Manejador del I2C que finalizó la transferencia.
+ */
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c != &hi2c1 || !asyncBusy)
+		return;
+
+	HD44780_Port_Async_Done(HD44780_PORT_OK);
+}
+
+/**
+ * @brief Callback de la HAL ante un error (NACK, pérdida de arbitraje) en una transmisión I2C.
+ *
+ * @param hi2c Manejador del I2C en el que ocurrió el error.
+ */
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c != &hi2c1 || !asyncBusy)
+		return;
+
+	HD44780_Port_Async_Done(HD44780_PORT_ERROR);
+}
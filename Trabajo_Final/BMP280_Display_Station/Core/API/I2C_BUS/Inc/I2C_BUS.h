@@ -0,0 +1,56 @@
+/**
+ * @file I2C_BUS.h
+ * @author Ing. Lucas Kirschner
+ * @date 16 Oct 2026
+ * @brief Arbitraje del I2C1 compartido entre el display y los sensores en ese bus.
+ *
+ * Mientras una transferencia por DMA ocupa `hi2c1`, la HAL rechaza cualquier otra con HAL_BUSY.
+ * El volcado por DMA del display toma el bus y lo libera en la interrupción que lo cierra; las
+ * transacciones de un sensor lo toman mientras duran. Quien lo encuentra ocupado no espera:
+ * devuelve "ocupado" y reintenta en la próxima pasada de la FSM, sin que ninguno de los dos
+ * drivers dependa del puerto del otro. Las transferencias bloqueantes del display corren en el
+ * contexto principal y nunca se solapan con las de un sensor, por lo que no necesitan tomarlo.
+ *
+ * El bus se toma sólo desde el contexto principal; la interrupción que cierra una
+ * transferencia por DMA sólo lo libera, por lo que la consulta y la asignación de
+ * ::I2C_BUS_Acquire no necesitan deshabilitar interrupciones.
+ */
+
+#ifndef I2C_BUS_INC_I2C_BUS_H_
+#define I2C_BUS_INC_I2C_BUS_H_
+
+#include <stdbool.h>
+
+/**
+ * @brief Dueños posibles del bus.
+ */
+typedef enum
+{
+	I2C_BUS_FREE = 0,              /**< Nadie está transmitiendo */
+	I2C_BUS_DISPLAY,               /**< Volcado del HD44780 (por DMA, se libera en la interrupción) */
+	I2C_BUS_SENSOR                 /**< Transacción bloqueante de un BMP280 en I2C */
+} i2c_bus_owner_t;
+
+/**
+ * @brief Toma el bus para `owner`.
+ *
+ * @param owner Quien va a transmitir (distinto de I2C_BUS_FREE).
+ * @return true si el bus estaba libre o ya era de `owner`; false si lo tiene otro.
+ */
+bool I2C_BUS_Acquire(i2c_bus_owner_t owner);
+
+/**
+ * @brief Libera el bus si lo tiene `owner`. Puede llamarse desde una interrupción.
+ *
+ * @param owner Quien terminó de transmitir.
+ */
+void I2C_BUS_Release(i2c_bus_owner_t owner);
+
+/**
+ * @brief Devuelve el dueño actual del bus.
+ *
+ * @return I2C_BUS_FREE si nadie lo está usando.
+ */
+i2c_bus_owner_t I2C_BUS_Get_Owner(void);
+
+#endif /* I2C_BUS_INC_I2C_BUS_H_ */
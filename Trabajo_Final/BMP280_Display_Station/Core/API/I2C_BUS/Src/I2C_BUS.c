@@ -0,0 +1,33 @@
+/**
+ * @file I2C_BUS.c
+ * @author Ing. Lucas Kirschner
+ * @date 16 Oct 2026
+ * @brief Implementación del arbitraje del I2C1 compartido.
+ */
+
+#include "I2C_BUS.h"
+
+static volatile i2c_bus_owner_t busOwner = I2C_BUS_FREE;	/**< Liberado también desde la interrupción del DMA */
+
+bool I2C_BUS_Acquire(i2c_bus_owner_t owner)
+{
+	if(owner == I2C_BUS_FREE)
+		return false;
+
+	if(busOwner != I2C_BUS_FREE && busOwner != owner)
+		return false;
+
+	busOwner = owner;
+	return true;
+}
+
+void I2C_BUS_Release(i2c_bus_owner_t owner)
+{
+	if(busOwner == owner)
+		busOwner = I2C_BUS_FREE;
+}
+
+i2c_bus_owner_t I2C_BUS_Get_Owner(void)
+{
+	return busOwner;
+}
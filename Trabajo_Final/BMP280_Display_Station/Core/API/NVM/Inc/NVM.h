@@ -0,0 +1,72 @@
+/**
+ * @file NVM.h
+ * @author Ing. Lucas Kirschner
+ * @date 15 Oct 2026
+ * @brief Abstracción de una región de memoria no volátil con semántica de flash NOR.
+ *
+ * La región se direcciona por desplazamiento desde su inicio. Como en la flash interna,
+ * el borrado deja todos los bytes en 0xFF y la programación sólo puede pasar bits de 1 a 0,
+ * por lo que una palabra ya escrita sólo puede reescribirse con un valor que apague bits.
+ *
+ * En el target la región es el sector 7 de la flash del STM32F446RE (0x08060000, 128 KB),
+ * excluido del linker script. Al compilar con `NVM_HOST` definido, la región es un arreglo
+ * en RAM que reproduce la misma semántica, lo que permite probar los módulos que la usan
+ * fuera del microcontrolador.
+ */
+
+#ifndef NVM_INC_NVM_H_
+#define NVM_INC_NVM_H_
+
+#include <stdint.h>
+
+/**
+ * @brief Códigos de estado del módulo NVM.
+ */
+typedef enum
+{
+	NVM_OK = 0,                    /**< Operación exitosa */
+	NVM_ERROR_PARAM,               /**< Desplazamiento, tamaño o alineación inválidos */
+	NVM_ERROR_WRITE                /**< Falla al borrar o programar la memoria */
+} nvm_status_t;
+
+/**
+ * @brief Devuelve el tamaño de la región en bytes.
+ *
+ * @return Tamaño de la región.
+ */
+uint32_t NVM_Size(void);
+
+/**
+ * @brief Lee bytes de la región.
+ *
+ * @param offset Desplazamiento desde el inicio de la región.
+ * @param data   Buffer destino.
+ * @param size   Cantidad de bytes a leer.
+ * @return NVM_OK o NVM_ERROR_PARAM si el rango excede la región.
+ */
+nvm_status_t NVM_Read(uint32_t offset, void *data, uint32_t size);
+
+/**
+ * @brief Programa palabras de 32 bits en la región.
+ *
+ * Cada palabra destino debe estar borrada, o el valor nuevo sólo debe apagar bits
+ * respecto del actual.
+ *
+ * @param offset Desplazamiento desde el inicio de la región, múltiplo de 4.
+ * @param data   Palabras a programar.
+ * @param words  Cantidad de palabras.
+ * @return NVM_OK, NVM_ERROR_PARAM o NVM_ERROR_WRITE.
+ */
+nvm_status_t NVM_Write(uint32_t offset, const uint32_t *data, uint32_t words);
+
+/**
+ * @brief Borra la región completa (todos los bytes quedan en 0xFF).
+ *
+ * En el target borra un sector de 128 KB, lo que bloquea durante un tiempo del orden
+ * del segundo; se debe reservar para cuando la región esté llena.
+ *
+ * @return NVM_OK o NVM_ERROR_WRITE.
+ */
+nvm_status_t NVM_Erase(void);
+
+#endif /* NVM_INC_NVM_H_ */
@@ -0,0 +1,138 @@
+/**
+ * @file NVM.c
+ * @author Ing. Lucas Kirschner
+ * @date 15 Oct 2026
+ * @brief Implementación de la región no volátil sobre la flash interna o, en host, sobre RAM.
+ */
+
+#include <string.h>
+
+#include "NVM.h"
+
+#ifdef NVM_HOST
+
+#define NVM_SIZE	1024u					/**< Región reducida para forzar el borrado en las pruebas */
+
+static uint8_t region[NVM_SIZE] = { [0 ... NVM_SIZE - 1] = 0xFF };
+
+static void NVM_Unlock(void)
+{
+}
+
+static void NVM_Lock(void)
+{
+}
+
+static nvm_status_t NVM_Program_Word(uint32_t offset, uint32_t word)
+{
+	uint32_t current;
+
+	memcpy(&current, &region[offset], sizeof(current));
+	current &= word;						/* Como en la flash: sólo se apagan bits */
+	memcpy(&region[offset], &current, sizeof(current));
+
+	return (current == word) ? NVM_OK : NVM_ERROR_WRITE;
+}
+
+nvm_status_t NVM_Erase(void)
+{
+	memset(region, 0xFF, sizeof(region));
+	return NVM_OK;
+}
+
+static const uint8_t *NVM_Base(void)
+{
+	return region;
+}
+
+#else
+
+#include "stm32f4xx_hal.h"
+
+#define NVM_SECTOR		FLASH_SECTOR_7		/**< Sector reservado en el linker script */
+#define NVM_BASE_ADDR	0x08060000u			/**< Dirección de inicio del sector 7 */
+#define NVM_SIZE		0x20000u			/**< 128 KB */
+
+static void NVM_Unlock(void)
+{
+	HAL_FLASH_Unlock();
+}
+
+/**
+ * @brief Bloquea la flash y descarta la caché de datos, que no se actualiza al programar.
+ */
+static void NVM_Lock(void)
+{
+	HAL_FLASH_Lock();
+
+	if(READ_BIT(FLASH->ACR, FLASH_ACR_DCEN))
+	{
+		__HAL_FLASH_DATA_CACHE_DISABLE();
+		__HAL_FLASH_DATA_CACHE_RESET();
+		__HAL_FLASH_DATA_CACHE_ENABLE();
+	}
+}
+
+static nvm_status_t NVM_Program_Word(uint32_t offset, uint32_t word)
+{
+	if(HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, NVM_BASE_ADDR + offset, word) != HAL_OK)
+		return NVM_ERROR_WRITE;
+
+	return NVM_OK;
+}
+
+nvm_status_t NVM_Erase(void)
+{
+	FLASH_EraseInitTypeDef erase;
+	uint32_t sectorError;
+	HAL_StatusTypeDef status;
+
+	erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+	erase.Banks = FLASH_BANK_1;
+	erase.Sector = NVM_SECTOR;
+	erase.NbSectors = 1;
+	erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;	/* 2,7 V a 3,6 V: programación por palabra */
+
+	HAL_FLASH_Unlock();
+	status = HAL_FLASHEx_Erase(&erase, &sectorError);
+	HAL_FLASH_Lock();
+
+	return (status == HAL_OK) ? NVM_OK : NVM_ERROR_WRITE;
+}
+
+static const uint8_t *NVM_Base(void)
+{
+	return (const uint8_t *)NVM_BASE_ADDR;
+}
+
+#endif /* NVM_HOST */
+
+uint32_t NVM_Size(void)
+{
+	return NVM_SIZE;
+}
+
+nvm_status_t NVM_Read(uint32_t offset, void *data, uint32_t size)
+{
+	if(data == NULL || offset > NVM_SIZE || size > NVM_SIZE - offset)
+		return NVM_ERROR_PARAM;
+
+	memcpy(data, NVM_Base() + offset, size);
+
+	return NVM_OK;
+}
+
+nvm_status_t NVM_Write(uint32_t offset, const uint32_t *data, uint32_t words)
+{
+	if(data == NULL || (offset & 3u) || offset > NVM_SIZE || words > (NVM_SIZE - offset) / 4u)
+		return NVM_ERROR_PARAM;
+
+	nvm_status_t status = NVM_OK;
+
+	NVM_Unlock();
+	for(uint32_t i = 0; i < words && status == NVM_OK; i++)
+		status = NVM_Program_Word(offset + 4u * i, data[i]);
+	NVM_Lock();
+
+	return status;
+}
@@ -0,0 +1,103 @@
+/**
+ * @file STATS.h
+ * @author Ing. Lucas Kirschner
+ * @date 15 Oct 2026
+ * @brief Estadísticas incrementales sobre una ventana deslizante de muestras.
+ *
+ * Cada ventana guarda las últimas `length` muestras de un canal (temperatura, presión) en
+ * memoria fija dentro de la propia estructura, sin reservas dinámicas, y mantiene al día:
+ *  - media y varianza por el método de Welford, que al entrar una muestra y salir la más
+ *    vieja se actualizan en O(1) sin volver a recorrer la ventana;
+ *  - mínimo y máximo con dos colas monótonas (O(1) amortizado por muestra);
+ *  - una media móvil exponencial (EMA), independiente del largo de la ventana.
+ *
+ * Para que el error de redondeo de las actualizaciones en simple precisión no se acumule,
+ * cada vez que la ventana da una vuelta completa la media y la varianza se recalculan sobre
+ * las muestras guardadas (O(length) cada `length` muestras, es decir O(1) por muestra).
+ */
+
+#ifndef STATS_INC_STATS_H_
+#define STATS_INC_STATS_H_
+
+#include <stdint.h>
+
+#define STATS_WINDOW_MAX		64u		/**< Largo máximo de una ventana (muestras) */
+
+/**
+ * @brief Códigos de estado del módulo STATS.
+ */
+typedef enum
+{
+	STATS_OK = 0,                  /**< Operación exitosa */
+	STATS_EMPTY,                   /**< La ventana todavía no tiene muestras */
+	STATS_ERROR_PARAM              /**< Largo de ventana o factor de suavizado inválidos */
+} stats_status_t;
+
+/**
+ * @brief Resultado de una ventana.
+ */
+typedef struct
+{
+	float min;                     /**< Mínimo de la ventana */
+	float max;                     /**< Máximo de la ventana */
+	float mean;                    /**< Media de la ventana */
+	float variance;                /**< Varianza muestral de la ventana (0 con una sola muestra) */
+	float ema;                     /**< Media móvil exponencial de todas las muestras */
+	uint8_t count;                 /**< Muestras en la ventana (hasta `length`) */
+} stats_summary_t;
+
+/**
+ * @brief Ventana deslizante de un canal. Se modifica sólo con las funciones del módulo.
+ */
+typedef struct
+{
+	float samples[STATS_WINDOW_MAX];   /**< Últimas muestras, en orden circular */
+	uint8_t minQueue[STATS_WINDOW_MAX]; /**< Posiciones de `samples` con valores crecientes */
+	uint8_t maxQueue[STATS_WINDOW_MAX]; /**< Posiciones de `samples` con valores decrecientes */
+	uint8_t minHead, minCount;
+	uint8_t maxHead, maxCount;
+	uint8_t length;                /**< Largo configurado de la ventana */
+	uint8_t next;                  /**< Posición de la próxima muestra (la más vieja, si está llena) */
+	uint8_t count;                 /**< Muestras en la ventana */
+	float mean;                    /**< Media de Welford */
+	float m2;                      /**< Suma de cuadrados de las desviaciones de Welford */
+	float alpha;                   /**< Factor de suavizado de la EMA */
+	float ema;                     /**< Media móvil exponencial */
+} stats_window_t;
+
+/**
+ * @brief Inicializa una ventana vacía.
+ *
+ * @param win    Ventana a inicializar.
+ * @param length Muestras de la ventana (1 ... STATS_WINDOW_MAX).
+ * @param alpha  Peso de la muestra nueva en la EMA (0 < alpha <= 1); 2 / (N + 1) equivale en
+ *               retardo a una media de N muestras.
+ * @return STATS_OK o STATS_ERROR_PARAM.
+ */
+stats_status_t STATS_Init(stats_window_t *win, uint8_t length, float alpha);
+
+/**
+ * @brief Descarta las muestras de la ventana y la EMA, conservando la configuración.
+ *
+ * @param win Ventana a vaciar.
+ */
+void STATS_Reset(stats_window_t *win);
+
+/**
+ * @brief Agrega una muestra; si la ventana está llena, sale la más vieja.
+ *
+ * @param win    Ventana destino.
+ * @param sample Valor a agregar.
+ */
+void STATS_Add(stats_window_t *win, float sample);
+
+/**
+ * @brief Devuelve el estado actual de la ventana.
+ *
+ * @param win Ventana a consultar.
+ * @param out Destino del resumen.
+ * @return STATS_OK, STATS_EMPTY si no hay muestras o STATS_ERROR_PARAM.
+ */
+stats_status_t STATS_Get(const stats_window_t *win, stats_summary_t *out);
+
+#endif /* STATS_INC_STATS_H_ */
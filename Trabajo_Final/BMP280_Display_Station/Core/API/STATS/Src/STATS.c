@@ -0,0 +1,151 @@
+/**
+ * @file STATS.c
+ * @author Ing. Lucas Kirschner
+ * @date 15 Oct 2026
+ * @brief Implementación de las estadísticas incrementales por ventana deslizante.
+ *
+ * Las colas de mínimo y máximo guardan posiciones de `samples`. La de mínimo mantiene
+ * valores crecientes desde el frente: al entrar una muestra se descartan desde el final las
+ * que son mayores o iguales, que ya no pueden ser mínimo mientras la nueva siga en la
+ * ventana. El frente es siempre el mínimo, y sale cuando su posición se sobrescribe.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "STATS.h"
+
+#define QUEUE_MASK		(STATS_WINDOW_MAX - 1u)	/* STATS_WINDOW_MAX es potencia de dos */
+
+/**
+ * @brief Recalcula media y varianza sobre la ventana llena, en dos pasadas.
+ *
+ * @param win Ventana a resincronizar.
+ */
+static void STATS_Resync(stats_window_t *win)
+{
+	float sum = 0.0f, m2 = 0.0f;
+
+	for(uint8_t i = 0; i < win->length; i++)
+		sum += win->samples[i];
+	win->mean = sum / win->length;
+
+	for(uint8_t i = 0; i < win->length; i++)
+	{
+		float delta = win->samples[i] - win->mean;
+		m2 += delta * delta;
+	}
+	win->m2 = m2;
+}
+
+stats_status_t STATS_Init(stats_window_t *win, uint8_t length, float alpha)
+{
+	if(win == NULL || length == 0 || length > STATS_WINDOW_MAX || !(alpha > 0.0f && alpha <= 1.0f))
+		return STATS_ERROR_PARAM;
+
+	win->length = length;
+	win->alpha = alpha;
+	STATS_Reset(win);
+
+	return STATS_OK;
+}
+
+void STATS_Reset(stats_window_t *win)
+{
+	if(win == NULL)
+		return;
+
+	win->minHead = win->minCount = 0;
+	win->maxHead = win->maxCount = 0;
+	win->next = 0;
+	win->count = 0;
+	win->mean = 0.0f;
+	win->m2 = 0.0f;
+	win->ema = 0.0f;
+}
+
+void STATS_Add(stats_window_t *win, float sample)
+{
+	if(win == NULL || win->length == 0)
+		return;
+
+	uint8_t slot = win->next;
+	bool full = (win->count == win->length);
+
+	/* EMA: la primera muestra la inicializa */
+	if(win->count == 0)
+		win->ema = sample;
+	else
+		win->ema += win->alpha * (sample - win->ema);
+
+	/* La muestra que sale deja las colas si todavía está al frente */
+	if(full)
+	{
+		if(win->minCount != 0 && win->minQueue[win->minHead] == slot)
+		{
+			win->minHead = (win->minHead + 1u) & QUEUE_MASK;
+			win->minCount--;
+		}
+		if(win->maxCount != 0 && win->maxQueue[win->maxHead] == slot)
+		{
+			win->maxHead = (win->maxHead + 1u) & QUEUE_MASK;
+			win->maxCount--;
+		}
+	}
+
+	while(win->minCount != 0 && win->samples[win->minQueue[(win->minHead + win->minCount - 1u) & QUEUE_MASK]] >= sample)
+		win->minCount--;
+	win->minQueue[(win->minHead + win->minCount) & QUEUE_MASK] = slot;
+	win->minCount++;
+
+	while(win->maxCount != 0 && win->samples[win->maxQueue[(win->maxHead + win->maxCount - 1u) & QUEUE_MASK]] <= sample)
+		win->maxCount--;
+	win->maxQueue[(win->maxHead + win->maxCount) & QUEUE_MASK] = slot;
+	win->maxCount++;
+
+	/* Welford: alta de una muestra, o reemplazo de la más vieja con la ventana llena */
+	if(!full)
+	{
+		float delta = sample - win->mean;
+
+		win->count++;
+		win->mean += delta / win->count;
+		win->m2 += delta * (sample - win->mean);
+	}
+	else
+	{
+		float old = win->samples[slot];
+		float oldMean = win->mean;
+		float delta = sample - old;
+
+		win->mean += delta / win->length;
+		win->m2 += delta * (sample - win->mean + old - oldMean);
+		if(win->m2 < 0.0f)
+			win->m2 = 0.0f;					/* Redondeo con varianza casi nula */
+	}
+
+	win->samples[slot] = sample;
+	win->next = (slot + 1u == win->length) ? 0 : slot + 1u;
+
+	/* Una vuelta completa: se descarta el error acumulado por las actualizaciones */
+	if(full && win->next == 0)
+		STATS_Resync(win);
+}
+
+stats_status_t STATS_Get(const stats_window_t *win, stats_summary_t *out)
+{
+	if(win == NULL || out == NULL)
+		return STATS_ERROR_PARAM;
+
+	if(win->count == 0)
+		return STATS_EMPTY;
+
+	out->min = win->samples[win->minQueue[win->minHead]];
+	out->max = win->samples[win->maxQueue[win->maxHead]];
+	out->mean = win->mean;
+	out->variance = (win->count > 1) ? win->m2 / (win->count - 1u) : 0.0f;
+	out->ema = win->ema;
+	out->count = win->count;
+
+	return STATS_OK;
+}
@@ -15,9 +15,14 @@
 /* USER CODE BEGIN Includes */
 #include <stdint.h>    /**< Manejo de tipos estándar */
 #include <stdbool.h>   /**< Manejo de tipos booleanos estándar */
+#include <stdio.h>     /**< snprintf para armar las líneas del display */
 #include "BMP280.h"    /**< Librería para el manejo del sensor BMP280 */
+#include "BMP280_rate.h" /**< Período y sobremuestreo adaptivos del BMP280 */
+#include "BMP280_cache.h" /**< Borrado diferido de la caché de calibración */
 #include "HD44780.h"   /**< Librería para el control del display LCD HD44780 */
 #include "DELAY.h"     /**< Librería para funciones de retardo */
+#include "STATS.h"     /**< Estadísticas por ventana deslizante de las lecturas */
+#include "ALTITUDE.h"  /**< Altitud barométrica y QNH (sólo su benchmark; el display no tiene lugar para mostrarlas) */
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -30,11 +35,13 @@ typedef enum
 {
     INIT_COMPONENTS, 		/**< Inicialización de periféricos y dispositivos */
     START_MEASUREMENT, 		/**< Inicio de medición del sensor BMP280 */
-    WAIT_MEASUREMENT, 		/**< Espera a que finalice la medición */
-    PROCESS_DATA, 			/**< Procesamiento de datos del sensor */
+    WAIT_MEASUREMENT, 		/**< Espera a que finalice la medición y lee los datos (modo forced) */
+    PROCESS_DATA, 			/**< Inicio de la lectura de datos del sensor por DMA */
+    WAIT_DATA, 				/**< Espera de la ráfaga y compensación de los datos */
     ANALYZE_DATA, 			/**< Análisis de los datos medidos */
     DISPLAY_DATA, 			/**< Actualización del display con datos medidos */
-    WAIT_TIME, 				/**< Espera de tiempo entre mediciones (no implementado en esta versión) */
+    WAIT_TIME, 				/**< Espera de tiempo entre mediciones */
+    RECOVER_SENSOR, 		/**< Recuperación del BMP280 sin reinicializar todo */
     ERROR_STATE 			/**< Manejo de errores */
 } state_t;
 
@@ -45,9 +52,20 @@ typedef enum
 #define TEMP_MIN_C		25.0		/**< Temperatura mínima aceptada (°C) */
 #define TEMP_MAX_C		30.0		/**< Temperatura máxima aceptada (°C) */
 
-#define DELAY_FSM		1000		/**< Período de actualización de la FSM (ms) */
+#define DELAY_FSM		1000		/**< Período inicial de la FSM; luego lo fija el nivel de BMP280_rate (ms) */
 #define DELAY_LED		250			/**< Período de parpadeo del LED en estado de error (ms) */
-#define DELAY_REINIT	2000		/**< Tiempo de espera para reintentar inicialización tras un error (ms) */
+#define DELAY_REINIT	2000		/**< Espera máxima para reintentar la inicialización tras un error (ms) */
+#define DELAY_BACKOFF	50			/**< Primera espera tras un error; se duplica en cada falla hasta DELAY_REINIT (ms) */
+#define DELAY_DMA_MARGIN	2		/**< Margen sobre la duración de la ráfaga por DMA antes de darla por colgada (ms) */
+#define DISPLAY_MAX_ERRORS	3		/**< Volcados fallidos seguidos antes de reinicializar sólo el display */
+
+#define ACQ_CONTINUOUS	true		/**< true: BMP280 en NORMAL_MODE (auto-temporizado); false: disparo FORCED por ciclo */
+#define BMP280_CS_INDEX	0			/**< Entrada de la tabla de chip selects del puerto BMP280 */
+
+#define STATS_WINDOW	60			/**< Muestras de la ventana de estadísticas */
+#define STATS_ALPHA		0.2f		/**< Suavizado de la EMA que usan la alarma y el display */
+
+#define BENCH_ITERATIONS	1000	/**< Iteraciones del benchmark de compensación (con BMP280_BENCHMARK) */
 
 /* USER CODE END PD */
 
@@ -64,11 +82,30 @@ SPI_HandleTypeDef hspi3;
 /* USER CODE BEGIN PV */
 
 bmp280_t bmp;					/**< Estructura de datos del sensor BMP280 */
+bmp280_ring_t samples;			/**< Muestras publicadas por el driver, con marca de tiempo */
+bmp280_ring_reader_t displayReader;	/**< Consumidor del display: lee a su ritmo, cuenta desbordes */
+bmp280_sample_t lastSample;		/**< Última muestra consumida por el display */
+bmp280_rate_t rate;				/**< Control adaptivo: nivel, umbrales y contadores */
+stats_window_t tempStats;		/**< Estadísticas de temperatura (°C) */
+stats_window_t pressStats;		/**< Estadísticas de presión (hPa) */
+stats_summary_t tempSummary;	/**< Resumen de temperatura tras la última muestra */
+stats_summary_t pressSummary;	/**< Resumen de presión tras la última muestra */
 state_t  state;					/**< Estado actual de la máquina de estados */
 delay_t  delayFSM;				/**< Temporizador para el control de la FSM */
 delay_t  delayLED;				/**< Temporizador para el parpadeo del LED */
 delay_t  delayReinit;			/**< Temporizador para reintento de inicialización */
+delay_t  delayMeas;				/**< Temporizador hasta el fin garantizado de la conversión */
+delay_t  delayData;				/**< Plazo de la ráfaga por DMA: si vence, el DMA quedó colgado */
+char	 displayLine[COLUMN_NUMBERS + 1];	/**< Línea del display en armado */
+bool 	 clockNegotiated;		/**< La velocidad de SCK ya se negoció (una sola vez, al arrancar) */
+bool 	 levelChanged;			/**< El control de tasa cambió de nivel y falta aplicarlo */
+bool 	 displayPending;		/**< El framebuffer tiene una pantalla nueva sin volcar */
+volatile bool displayFailed;	/**< Falló un volcado asíncrono (se marca en la interrupción del I2C) */
+volatile uint8_t displayErrors;	/**< Volcados fallidos seguidos (vuelve a 0 con uno exitoso) */
+bool 	 displayReady;			/**< El display respondió a HD44780_Init */
 bool 	 tempOutRange;			/**< Bandera que indica si la temperatura está fuera de rango) */
+uint32_t backoffMs;				/**< Espera del próximo reintento de inicialización */
+uint32_t fullRestarts;			/**< Reinicializaciones completas (último nivel de recuperación) */
 
 
 /* USER CODE END PV */
@@ -122,6 +159,12 @@ int main(void)
   MX_GPIO_Init();
   /* USER CODE BEGIN 2 */
 
+#ifdef BMP280_BENCHMARK
+  BMP280_Benchmark_Compensation(BENCH_ITERATIONS);	/**< Compara los algoritmos de compensación por SWO */
+  ALTITUDE_Benchmark(BENCH_ITERATIONS);				/**< Exactitud y costo de la altitud frente a powf */
+  HD44780_Benchmark_Redraw();						/**< Tiempo de redibujar el display completo */
+#endif
+
   FSM_Init();			/**< Inicializa la máquina de estados */
 
   /* USER CODE END 2 */
@@ -254,9 +297,20 @@ static void FSM_Init(void)
 {
 	  Delay_Init(&delayFSM, DELAY_FSM);
 	  Delay_Init(&delayLED, DELAY_LED);
-	  Delay_Init(&delayReinit, DELAY_REINIT);
+	  Delay_Init(&delayReinit, DELAY_BACKOFF);
+	  backoffMs = DELAY_BACKOFF;
+	  Delay_Init(&delayMeas, 0);
+	  Delay_Init(&delayData, 0);
 
 	  tempOutRange = false;					/**< Condición inicial de medición fuera de rango */
+	  displayPending = false;
+	  displayFailed = false;
+	  displayErrors = 0;
+	  displayReady = false;
+	  clockNegotiated = false;
+	  STATS_Init(&tempStats, STATS_WINDOW, STATS_ALPHA);	/**< Sobreviven a los reinicios del sensor */
+	  STATS_Init(&pressStats, STATS_WINDOW, STATS_ALPHA);
+	  BMP280_Rate_Init(&rate, NULL);		/**< Política por defecto, arranca en el nivel más lento */
 	  state = INIT_COMPONENTS; 				/**< Estado inicial de la máquina de estados */
 }
 
@@ -265,117 +319,153 @@ static void FSM_Init(void)
  */
 static void FSM_Update(void)
 {
+	bmp280_status_t status;
+	uint32_t clockHz;
+
 	switch (state)
 	{
 	case INIT_COMPONENTS:					/**< Inicicalización de periféricos y dispositivos */
-		if(BMP280_Init() != BMP280_OK)		/**< Inicialización del sensor BMP280 e interfaz SPI */
+		if(BMP280_Init(&bmp, BMP280_CS_INDEX) != BMP280_OK)		/**< Inicialización del sensor BMP280 e interfaz SPI */
 		{
 			state = ERROR_STATE;
 			break;
 		}
+		if(!clockNegotiated)				/**< Los reintentos conservan la velocidad en el descriptor */
+		{
+			if(BMP280_Negotiate_Clock(&bmp) != BMP280_OK)	/**< SCK a la mayor velocidad confiable */
+			{
+				state = ERROR_STATE;
+				break;
+			}
+			clockNegotiated = true;
+		}
+		BMP280_Ring_Init(&samples);			/**< Cada lectura se publica en el buffer de muestras */
+		BMP280_Attach_Ring(&bmp, &samples);
+		BMP280_Ring_Reader_Init(&samples, &displayReader);
+
+		/* Display HD44780 e interfaz I2C. Si falla, DISPLAY_DATA lo reintenta sin tocar el sensor */
+		displayReady = (HD44780_Init() == HD44780_OK);
+		displayErrors = 0;
 
-		if(HD44780_Init() != HD44780_OK)	/**< Inicialización del display HD44780 e interfaz I2C */
+		HAL_GPIO_WritePin(LD2_GPIO_Port, LD2_Pin, true);	/**< Led verde inicia encendido, toggle indica error */
+
+		if(BMP280_Rate_Apply(&rate, &bmp) != BMP280_OK)	/**< Sobremuestreo del nivel adaptivo vigente */
 		{
 			state = ERROR_STATE;
 			break;
 		}
 
-		HAL_GPIO_WritePin(LD2_GPIO_Port, LD2_Pin, true);	/**< Led verde inicia encendido, toggle indica error */
+		if(ACQ_CONTINUOUS)					/**< El sensor mide solo; la FSM lee una vez por período */
+		{
+			if(BMP280_Start_Continuous(&bmp, BMP280_Rate_Get_Level(&rate)->standby) != BMP280_OK)
+			{
+				state = ERROR_STATE;
+				break;
+			}
+			Delay_Write(&delayFSM, BMP280_Get_Period_Ms(&bmp));
+			state = WAIT_TIME;				/**< Primera lectura tras una medición completa */
+			break;
+		}
 
+		Delay_Write(&delayFSM, BMP280_Rate_Get_Level(&rate)->periodMs);
 		state = START_MEASUREMENT;			/**< Si salió bien, paso al siguiente estado */
 		break;
 
 	case START_MEASUREMENT:					/**< Le indica al BMP280 que inicie una medición */
-		if(BMP280_Trigger_Measurement() != BMP280_OK)
+		status = BMP280_Trigger_Measurement(&bmp);
+		if(status == BMP280_BUSY)
+			break;							/**< El display tiene el I2C1: se reintenta en la próxima pasada */
+		if(status != BMP280_OK)
 		{
-			state = ERROR_STATE;
+			state = RECOVER_SENSOR;
 			break;
 		}
+		Delay_Write(&delayMeas, BMP280_Get_Measurement_Time_Ms(&bmp) + 1);	/**< Plazo según osrs_t/osrs_p (+1 tick de margen) */
+		Delay_Read(&delayMeas);				/**< Arranca el temporizador */
 		state = WAIT_MEASUREMENT;
 		break;
 
-	case WAIT_MEASUREMENT:					/**< Espera a que el BMP280 finalice la medición */
-		bmp280_status_t status = BMP280_Is_Measuring();
-		if(status == BMP280_DATA_RDY)
-			state = PROCESS_DATA;
-		else if(status != BMP280_DATA_NOT_RDY)
-			state = ERROR_STATE;
+	case WAIT_MEASUREMENT:					/**< Espera el plazo de conversión y lee estado + datos en una ráfaga */
+		if(!Delay_Read(&delayMeas))
+			break;
+		status = BMP280_Read_If_Ready(&bmp);
+		if(status == BMP280_OK)
+			state = ANALYZE_DATA;
+		else if(status != BMP280_DATA_NOT_RDY && status != BMP280_BUSY)
+			state = RECOVER_SENSOR;			/**< Error persistente o configuración perdida (BMP280_ERROR_CONFIG): reset por software */
 		break;
 
-	case PROCESS_DATA:						/**< Lee los datos crudos y los compensa */
-		if(BMP280_Update_Parameters(&bmp) != BMP280_OK)
+	case PROCESS_DATA:						/**< Lanza la lectura de los datos crudos por DMA */
+		status = BMP280_Start_Read_Async(&bmp);
+		if(status == BMP280_BUSY)
+			break;
+		if(status != BMP280_OK)
 		{
-			state = ERROR_STATE;
+			state = RECOVER_SENSOR;
 			break;
 		}
-		state = ANALYZE_DATA;
+		clockHz = BMP280_Get_Clock_Hz(&bmp);	/**< Plazo: la ráfaga (y su repetición) a la velocidad de SCK en uso, más margen */
+		Delay_Init(&delayData, 2 * ((clockHz != 0) ? (BMP280_ASYNC_SIZE * 8u * 1000u + clockHz - 1) / clockHz : 0) + DELAY_DMA_MARGIN);
+		Delay_Read(&delayData);				/**< Arranca el temporizador */
+		state = WAIT_DATA;
 		break;
 
-	case ANALYZE_DATA:						/**< Analiza si la temperatura esta fuera de rango */
-		if(bmp.temperature < TEMP_MIN_C || bmp.temperature > TEMP_MAX_C)
-			tempOutRange = true;
-		else
-			tempOutRange = false;
-		state = DISPLAY_DATA;
+	case WAIT_DATA:							/**< Espera el fin de la ráfaga sin bloquear y compensa */
+		status = BMP280_Finish_Read_Async(&bmp);
+		if(status == BMP280_OK)
+			state = ANALYZE_DATA;
+		else if(status != BMP280_DATA_NOT_RDY)
+			state = RECOVER_SENSOR;
+		else if(Delay_Read(&delayData))		/**< Ni la interrupción de fin ni la de error llegaron: DMA colgado */
+			state = RECOVER_SENSOR;			/**< BMP280_Recover lo aborta en el nivel 3 */
 		break;
 
-	case DISPLAY_DATA:						/**< Actualiza los datos del display */
-		if(HD44780_Set_Cursor(1,1) != HD44780_OK)
-		{
-			state = ERROR_STATE;
-			break;
-		}
-		if(HD44780_Write((uint8_t *)"Temp: ") != HD44780_OK)
-		{
-			state = ERROR_STATE;
-			break;
-		}
-		if(HD44780_Write_int((int16_t) bmp.temperature) != HD44780_OK)
-		{
-			state = ERROR_STATE;
-			break;
-		}
-		if(HD44780_Write((uint8_t *)" C") != HD44780_OK)
-		{
-			state = ERROR_STATE;
-			break;
+	case ANALYZE_DATA:						/**< Analiza si la temperatura esta fuera de rango */
+		while(BMP280_Ring_Pop(&samples, &displayReader, &lastSample))
+		{									/**< Cada muestra pendiente entra a las estadísticas y al control de tasa */
+			STATS_Add(&tempStats, lastSample.temperature);
+			STATS_Add(&pressStats, lastSample.pressure);
+			levelChanged |= BMP280_Rate_Update(&rate, &lastSample);
 		}
-		if(tempOutRange)	/**< Advertencia */
+		if(levelChanged)					/**< Evento o calma: cambia período y sobremuestreo */
 		{
-			if(HD44780_Write((uint8_t *)" (!)") != HD44780_OK)
+			status = BMP280_Rate_Apply(&rate, &bmp);
+			if(status == BMP280_OK)
 			{
-				state = ERROR_STATE;
-				break;
+				levelChanged = false;
+				Delay_Write(&delayFSM, ACQ_CONTINUOUS ? BMP280_Get_Period_Ms(&bmp) : BMP280_Rate_Get_Level(&rate)->periodMs);
 			}
-		}
-		else				/**< Limpio display */
-		{
-			if(HD44780_Write((uint8_t *)"    ") != HD44780_OK)
+			else if(status != BMP280_BUSY)	/**< Con el bus ocupado levelChanged sigue en true y se aplica en la próxima muestra */
 			{
-				state = ERROR_STATE;
+				state = RECOVER_SENSOR;		/**< levelChanged sigue en true: se reintenta en la próxima muestra */
 				break;
 			}
 		}
+		STATS_Get(&tempStats, &tempSummary);
+		STATS_Get(&pressStats, &pressSummary);
+		if(tempSummary.ema < TEMP_MIN_C || tempSummary.ema > TEMP_MAX_C)	/**< Suavizada: un pico aislado no dispara la alarma */
+			tempOutRange = true;
+		else
+			tempOutRange = false;
+		backoffMs = DELAY_BACKOFF;			/**< Hubo una muestra válida: la próxima falla arranca con la espera mínima */
+		state = DISPLAY_DATA;
+		break;
 
-		if(HD44780_Set_Cursor(2,1) != HD44780_OK)
-		{
-			state = ERROR_STATE;
-			break;
-		}
-		if(HD44780_Write((uint8_t *)"Pres: ") != HD44780_OK)
+	case DISPLAY_DATA:						/**< Actualiza los datos del display */
+		if(!displayReady)					/**< Display caído: se reinicializa sólo él, a lo sumo una vez por muestra */
 		{
-			state = ERROR_STATE;
-			break;
+			displayReady = (HD44780_Init() == HD44780_OK);
+			displayErrors = 0;
 		}
-		if(HD44780_Write_int((int16_t) bmp.pressure) != HD44780_OK)
+		if(displayReady)
 		{
-			state = ERROR_STATE;
-			break;
-		}
-		if(HD44780_Write((uint8_t *)" hPa") != HD44780_OK)
-		{
-			state = ERROR_STATE;
-			break;
+			HD44780_Fb_Clear();				/**< Se arma la pantalla completa; sólo viajan las celdas que cambian */
+			snprintf(displayLine, sizeof(displayLine), "Temp: %d C%s", (int16_t) tempSummary.ema,
+			         tempOutRange ? " (!)" : "");	/**< Advertencia */
+			HD44780_Fb_Write(1, 1, (uint8_t *)displayLine);
+			snprintf(displayLine, sizeof(displayLine), "Pres: %d hPa", (int16_t) pressSummary.ema);
+			HD44780_Fb_Write(2, 1, (uint8_t *)displayLine);
+			displayPending = true;			/**< Se vuelca por DMA desde WAIT_TIME, sin bloquear el lazo */
 		}
 
 		state = WAIT_TIME;
@@ -383,15 +473,49 @@ static void FSM_Update(void)
 		break;
 
 	case WAIT_TIME:						/**< Espera un tiempo para actualizar la medición (repite el ciclo) */
+		/* Las fallas del display nunca llegan al sensor: HD44780.c invalida su copia de la DDRAM
+		 * y la próxima pantalla (un período después) se envía completa */
+		if(displayFailed)
+		{
+			displayFailed = false;
+			if(displayErrors >= DISPLAY_MAX_ERRORS)
+				displayReady = false;		/**< Persistente: DISPLAY_DATA reinicializa sólo el display */
+		}
+		if(displayPending && !HD44780_Is_Busy())	/**< Si sigue el volcado anterior, se reintenta en la próxima pasada */
+		{
+			hd44780_status_t flushStatus = HD44780_Flush_Async();
+
+			if(flushStatus != HD44780_BUSY)	/**< Bus ocupado: se reintenta en la próxima pasada */
+				displayPending = false;
+			if(flushStatus != HD44780_OK && flushStatus != HD44780_BUSY && ++displayErrors >= DISPLAY_MAX_ERRORS)
+				displayReady = false;
+		}
+		if(!displayPending && !HD44780_Is_Busy())
+			BMP280_Cache_Service();			/**< Borrado diferido de la caché llena (1 a 2 s): sólo aquí, con todo quieto */
 		if(Delay_Read(&delayFSM))
-			state = START_MEASUREMENT;
+			state = ACQ_CONTINUOUS ? PROCESS_DATA : START_MEASUREMENT;	/**< En continuo: sólo la ráfaga */
+		break;
+
+	case RECOVER_SENSOR:				/**< Reset por software del BMP280 y, si no alcanza, del SPI */
+		if(BMP280_Recover(&bmp) != BMP280_OK)
+		{
+			state = ERROR_STATE;		/**< Último nivel: reinicialización completa con espera creciente */
+			break;
+		}
+		state = ACQ_CONTINUOUS ? WAIT_TIME : START_MEASUREMENT;	/**< Retoma el ciclo con la configuración activa */
 		break;
 
 	case ERROR_STATE:					/**< Se ejecuta si ocurre cualquier error */
+		if(!Delay_Is_Running(&delayReinit))
+			Delay_Write(&delayReinit, backoffMs);	/**< Al entrar: espera según las fallas previas */
 		if(Delay_Read(&delayLED))		/**< Toggle led verde de la Nucleo */
 			HAL_GPIO_TogglePin(LD2_GPIO_Port, LD2_Pin);
 		if(Delay_Read(&delayReinit))	/* Luego de cierto tiempo, intenta reiniciar */
+		{
+			backoffMs = (2 * backoffMs < DELAY_REINIT) ? 2 * backoffMs : DELAY_REINIT;
+			fullRestarts++;
 			state = INIT_COMPONENTS;
+		}
 		break;
 
 	default:
@@ -399,6 +523,22 @@ static void FSM_Update(void)
 	}
 }
 
+/**
+ * @brief Fin del volcado asíncrono del display (contexto de interrupción).
+ *
+ * @param status Resultado de la transferencia.
+ */
+void HD44780_Flush_Complete_Callback(hd44780_status_t status)
+{
+	if(status != HD44780_OK)
+	{
+		displayErrors++;
+		displayFailed = true;
+	}
+	else
+		displayErrors = 0;
+}
+
 /* USER CODE END 4 */
 
 /**